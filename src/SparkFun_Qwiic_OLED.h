@@ -56,16 +56,38 @@
 #include "qwiic_olednarrow.h"
 #include "qwiic_oledtransp.h"
 
+// retained mode support
+#include "qwiic_grdisplaylist.h"
+#include "qwiic_grsprite.h"
+#include "qwiic_grtextgrid.h"
+#include "qwiic_grnumfield.h"
+
+// offscreen drawing
+#include "qwiic_grcanvas.h"
+#include "qwiic_grlayers.h"
+
 #include <Arduino.h>
 #include <Wire.h>
 
 // Friendly typenames
 typedef QwFont QwiicFont;
 typedef QwBitmap QwiicBitmap;
+typedef QwDisplayList QwiicDisplayList;
+typedef QwSpriteLayer QwiicSpriteLayer;
+typedef QwTextGrid QwiicTextGrid;
+typedef QwNumberField QwiicNumberField;
+typedef QwCanvas QwiicCanvas;
+template <uint8_t W, uint8_t H> using QwiicCanvasBuffer = QwCanvasBuffer<W, H>;
+typedef QwLayerStack QwiicLayerStack;
 
 #define COLOR_WHITE 1
 #define COLOR_BLACK 0
 
+// Time between marquee steps in milliseconds - default and shortest. The SSD1306 needs
+// two frames between one column scrolls.
+#define kMarqueeInterval 30
+#define kMarqueeIntervalMin 20
+
 // The Plan:
 //
 // For each supported device the following is needed
@@ -99,6 +121,24 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
 
     uint8_t m_color;
 
+    // a UTF-8 character being collected by write()
+    char m_utf8[5];
+    uint8_t m_utf8Len;
+    uint8_t m_utf8Need;
+
+    // the last character written - for kerning with the next
+    uint16_t m_prevCode;
+
+    // console mode - print output scrolls up at the bottom of the screen
+    bool m_console;
+    bool m_consoleHW;       // scrolled with the display start line
+    bool m_startPending;    // start line to send on the next display()
+    uint8_t m_consoleTop;   // the screen buffer row shown on the top of the display
+
+    // marquee timing
+    uint16_t m_marqueeInterval;
+    uint32_t m_marqueeTime;
+
   public:
     ///////////////////////////////////////////////////////////////////////
     // begin()
@@ -121,6 +161,11 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         // defaults for Arduino Print
         setCursor(0, 0);
         setColor(COLOR_WHITE);
+        m_utf8Len = 0;
+        m_prevCode = 0;
+        m_console = m_consoleHW = m_startPending = false;
+        m_consoleTop = 0;
+        m_marqueeInterval = kMarqueeInterval;
 
         m_i2cBus.init(wirePort);
 
@@ -182,7 +227,13 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
 
     bool reset(bool clearDisplay)
     {
-        return m_device.reset(clearDisplay);
+        bool bStatus = m_device.reset(clearDisplay);
+
+        // the device is back at start line 0 - keep a scrolled console in place
+        if (bStatus && m_consoleTop)
+            m_device.setStartLine(m_consoleTop);
+
+        return bStatus;
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -196,6 +247,49 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
     void display(void)
     {
         m_device.display();
+
+        // A console scroll is shown once the new line is in the screen buffer
+        if (m_startPending)
+        {
+            m_device.setStartLine(m_consoleTop);
+            m_startPending = false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // display()
+    //
+    // Composes the changed areas of a layer stack into the screen buffer, and
+    // then sends any pending display updates to the connected OLED device.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theStack     The layer stack to compose
+
+    void display(QwiicLayerStack &theStack)
+    {
+        theStack.compose(m_device);
+        m_device.display();
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // display()
+    //
+    // Sends the changed cells of a text grid, and any pending display updates, to
+    // the connected OLED device. Only the cells that changed since the last update
+    // are drawn and sent.
+    //
+    // With the screen rotated 90 or 270 degrees, the cells are drawn to the graphics
+    // buffer and sent with the display update.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theGrid      The text grid to send
+
+    void display(QwiicTextGrid &theGrid)
+    {
+        theGrid.update(m_device);
+        display();
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -255,6 +349,96 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         m_device.flipHorz(bFlip);
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // setRotation()
+    //
+    // Rotates the screen clockwise by quarter turns. For 90 and 270 degrees, the
+    // width and height of the screen swap. The screen is cleared.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // rotation     0, 1, 2 or 3 - for 0, 90, 180 and 270 degrees
+    // retval       true on success, false if the rotation isn't supported
+
+    bool setRotation(uint8_t rotation)
+    {
+        if (!m_device.setRotation(rotation))
+            return false;
+
+        if (m_console)
+            setConsole(true);
+        else
+        {
+            m_cursorX = m_cursorY = 0;
+            m_utf8Len = 0;
+            m_prevCode = 0;
+        }
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // getRotation()
+    //
+    // Returns the current rotation of the screen
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // retval       0, 1, 2 or 3 - for 0, 90, 180 and 270 degrees
+
+    uint8_t getRotation(void)
+    {
+        return m_device.rotation();
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // setVirtualCanvas()
+    //
+    // Draws to a virtual canvas 64 pixels high - all rows of the device screen buffer, even on
+    // screens with fewer rows, like the Narrow (32) and Micro (48) OLEDs. getHeight() returns
+    // the canvas height, and the screen shows a window of the canvas, moved with
+    // setCanvasView() - without sending any graphics. The screen is cleared, and console mode
+    // is turned off - it can't be enabled while the canvas is set.
+    //
+    // The canvas needs a buffer of getWidth() * 8 bytes - 1024 bytes on the Narrow OLED, 512
+    // on the Micro OLED. Pass nullptr to go back to drawing to the screen.
+    //
+    // Not available on the 1.5" OLED.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // pBuffer      The buffer for the canvas, or nullptr to go back to the screen
+    // retval       true on success, false if the screen is rotated 90 or 270 degrees
+
+    bool setVirtualCanvas(uint8_t *pBuffer)
+    {
+        if (!m_device.setVirtualCanvas(pBuffer))
+            return false;
+
+        m_console = m_consoleHW = m_startPending = false;
+        m_consoleTop = 0;
+        m_cursorX = m_cursorY = 0;
+        m_utf8Len = 0;
+        m_prevCode = 0;
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // setCanvasView()
+    //
+    // Moves the window of the virtual canvas the screen shows - a single command, no graphics
+    // are sent. The canvas wraps - rows past the bottom of the canvas are shown from the top.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // y0           The row of the canvas shown on the top of the screen
+    // retval       true on success, false if no virtual canvas is set
+
+    bool setCanvasView(uint8_t y0)
+    {
+        return m_device.virtualCanvas() && m_device.setStartLine(y0);
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // scrollStop()
     //
@@ -355,6 +539,63 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         m_device.scroll(SCROLL_VERT_LEFT, start, stop, interval);
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // marquee()
+    //
+    // Starts a marquee - the text, in the current font, scrolls in from the right edge of
+    // the screen and across, over and over. Call marqueeUpdate() from loop() to move it.
+    //
+    // Each step scrolls the rows of the marquee one column on the device and sends just the
+    // new column - a few bytes, instead of the rows of the marquee. The rows are cleared when
+    // the marquee starts, and belong to the marquee until marqueeStop() is called.
+    //
+    // The text isn't copied - it must stay in place while the marquee runs.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // y0           The Y coordinate of the marquee - rounded down to a multiple of 8
+    // text         The text of the marquee
+    // interval     optional The time between steps in milliseconds - at least kMarqueeIntervalMin
+    // retval       true on success, false if the text doesn't fit at y0 or the screen is rotated 90 or 270 degrees
+
+    bool marquee(uint8_t y0, const char *text, uint16_t interval = kMarqueeInterval)
+    {
+        m_marqueeInterval = interval < kMarqueeIntervalMin ? kMarqueeIntervalMin : interval;
+        m_marqueeTime = millis();
+
+        return m_device.setMarquee(text, y0 / kByteNBits);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // marqueeUpdate()
+    //
+    // Moves the marquee one column, if the interval has passed since the last step. Call
+    // from loop() - no display() call is needed.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // retval       true if the marquee moved
+
+    bool marqueeUpdate(void)
+    {
+        if (!m_device.marqueeActive() || millis() - m_marqueeTime < m_marqueeInterval)
+            return false;
+
+        m_marqueeTime = millis();
+
+        return m_device.marqueeStep();
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // marqueeStop()
+    //
+    // Stops the marquee. The text stays on the screen where it is.
+
+    void marqueeStop(void)
+    {
+        m_device.setMarquee(nullptr, 0);
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // displayPower()
     //
@@ -391,10 +632,14 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
     //  Font            Include File            Font Variable       Description
     //  -----------     ---------------------   ----------------    ---------------------
     //  5x7             <res/qw_fnt_5x7.h>      QW_FONT_5X7         A full, 5 x 7 font
+    //  5x7 Prop.       <res/qw_fnt_5x7p.h>     QW_FONT_5X7P        A full, 5 x 7 proportional font, with kerning
+    //  5x7 Unicode     <res/qw_fnt_5x7u.h>     QW_FONT_5X7U        The 5 x 7 font, mapped to Unicode (sparse)
     //  31x48           <res/qw_fnt_31x48.h>    QW_FONT_31X48       A full, 31 x 48 font
+    //  31x48 Packed    <res/qw_fnt_31x48_rle.h> QW_FONT_31X48_RLE  The 31 x 48 font, compressed
     //  Seven Segment   <res/qw_fnt_7segment.h> QW_FONT_7SEGMENT    Numbers only
     //  8x16            <res/qw_fnt_8x16.h>     QW_FONT_8X16        A full, 8 x 16 font
     //  Large Numbers   <res/qw_fnt_largenum.h> QW_FONT_LARGENUM    Numbers only
+    //  Large Num. Pk.  <res/qw_fnt_largenum_rle.h> QW_FONT_LARGENUM_RLE Numbers only, compressed
     //
     //  For each font, the font variables are objects with the following attributes:
     //
@@ -516,6 +761,8 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
     //  grROPXOR        A XOR operation is performed between the source and destination values
     //  grROPBlack      A value of 0, or black is drawn to the destination
     //  grROPWhite      A value of 1, or black is drawn to the destination
+    //  grROPOr         A OR operation is performed between the source and destination values
+    //  grROPMask       Destination pixels are cleared where the source value is 1
 
     void setDrawMode(grRasterOp_t rop)
     {
@@ -537,6 +784,65 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         return m_device.rasterOp();
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // setFillPattern()
+    //
+    // Sets the pattern used by rectangleFill() and circleFill(). Only pixels set
+    // in the pattern are drawn, the others are left as is. The pattern repeats
+    // every 8 pixels across and down the screen, so fills next to each other line up.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // pPattern     8 bytes, one per column. Bit 0 of a byte is the top row. nullptr for solid fills
+
+    void setFillPattern(const uint8_t *pPattern)
+    {
+        m_device.setFillPattern(pPattern);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // setFillDither()
+    //
+    // Sets an ordered dither (8x8 Bayer) fill pattern - shades of gray for
+    // rectangleFill() and circleFill(). Level n draws n of every 64 pixels.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // level        0 (nothing drawn) to 64 (solid). 32 is a 50% checkerboard
+
+    void setFillDither(uint8_t level)
+    {
+        m_device.setFillDither(level);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // setClipRect()
+    //
+    // Limit all drawing operations to a rectangle on the screen. Pixels outside
+    // of the clip rectangle are not changed.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate of the clip rectangle - upper left corner
+    // y0           The Y coordinate of the clip rectangle - upper left corner
+    // width        The width of the clip rectangle
+    // height       The height of the clip rectangle
+
+    void setClipRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+    {
+        m_device.setClipRect(x0, y0, width, height);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // clearClipRect()
+    //
+    // Remove the current clip rectangle - drawing operations can use the full screen.
+
+    void clearClipRect(void)
+    {
+        m_device.clearClipRect();
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // Drawing methods
     ///////////////////////////////////////////////////////////////////////
@@ -687,6 +993,28 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
 
         m_device.bitmap(x0, y0, pBitmap, bmp_width, bmp_height);
     }
+
+    ///////////////////////////////////////////////////////////////////////
+    // bitmap()
+    //
+    // Draws a bitmap on the screen, with the bitmap data in the given format.
+    // Row major bitmaps (XBM, PBM) are converted as they are drawn.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate to place the bitmap - upper left corner
+    // y0           The Y coordinate to place the bitmap - upper left corner
+    // pBitmap      A pointer to the bitmap array
+    // bmp_width    The width of the bitmap
+    // bmp_height   The height of the bitmap
+    // format       The format of the bitmap data - grBitmapPage, grBitmapXBM, grBitmapPBM,
+    //              grBitmapRLE
+
+    void bitmap(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height,
+                grBitmapFormat_t format)
+    {
+        m_device.bitmap(x0, y0, pBitmap, bmp_width, bmp_height, format);
+    }
     ///////////////////////////////////////////////////////////////////////
     // bitmap()
     //
@@ -703,6 +1031,65 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         m_device.bitmap(x0, y0, bitmap);
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // copyRect()
+    //
+    // Copies a rectangle of the screen buffer to another location on the
+    // screen, using the current draw mode. The source and destination areas
+    // can overlap - this can be used to scroll part of the screen.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate of the source - upper left corner
+    // y0           The Y coordinate of the source - upper left corner
+    // width        The width of the area to copy
+    // height       The height of the area to copy
+    // x1           The X coordinate of the destination - upper left corner
+    // y1           The Y coordinate of the destination - upper left corner
+
+    void copyRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t x1, uint8_t y1)
+    {
+        m_device.copyRect(x0, y0, width, height, x1, y1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // copyRect()
+    //
+    // Copies a rectangle of an offscreen canvas to the screen, using the
+    // current draw mode.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theCanvas    The canvas to copy from
+    // x0           The X coordinate in the canvas - upper left corner
+    // y0           The Y coordinate in the canvas - upper left corner
+    // width        The width of the area to copy
+    // height       The height of the area to copy
+    // x1           The X coordinate on the screen - upper left corner
+    // y1           The Y coordinate on the screen - upper left corner
+
+    void copyRect(QwiicCanvas &theCanvas, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t x1,
+                  uint8_t y1)
+    {
+        m_device.copyRect(theCanvas, x0, y0, width, height, x1, y1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // canvas()
+    //
+    // Draws an offscreen canvas on the screen, using the current draw mode.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate to place the canvas - upper left corner
+    // y0           The Y coordinate to place the canvas - upper left corner
+    // theCanvas    The canvas to draw
+
+    void canvas(uint8_t x0, uint8_t y0, QwiicCanvas &theCanvas)
+    {
+        m_device.copyRect(theCanvas, 0, 0, theCanvas.width(), theCanvas.height(), x0, y0);
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // text()
     //
@@ -726,6 +1113,133 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         m_device.text(x0, y0, text.c_str(), clr);
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // text<Font>()
+    //
+    // Draws a string with a fixed width font given at compile time - the class of the
+    // font resource, for example text<QwFont8x16>(0, 0, "Hello"). The font layout is
+    // built in to the drawing code, which makes it faster than text(). The current font
+    // isn't changed.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // Font         The font class - QwFont5x7, QwFont8x16, QwFont31x48, QwFont7Segment, QwFontLargeNum
+    // x0           The X coordinate to start drawing the text
+    // y0           The Y coordinate to start drawing the text
+    // text         The string to draw on the screen
+    // clr          optional The color value to draw the text. This defaults to white (1).
+
+    template <typename Font> void text(uint8_t x0, uint8_t y0, const char *text, uint8_t clr = COLOR_WHITE)
+    {
+        m_device.template text<Font>(x0, y0, text, clr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // textScaled()
+    //
+    // Draws a string using the current font, scaled up 2, 3 or 4 times - each pixel
+    // of the font is drawn as a scale x scale block. The text is scale times the
+    // width and height returned by getStringWidth() and getStringHeight().
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate to start drawing the text
+    // y0           The Y coordinate to start drawing the text
+    // text         The string to draw on the screen
+    // scale        The scale of the text - 1 to 4
+    // clr          optional The color value to draw the text. This defaults to white (1).
+
+    void textScaled(uint8_t x0, uint8_t y0, const char *text, uint8_t scale, uint8_t clr = COLOR_WHITE)
+    {
+        m_device.textScaled(x0, y0, text, scale, clr);
+    }
+
+    void textScaled(uint8_t x0, uint8_t y0, String &text, uint8_t scale, uint8_t clr = COLOR_WHITE)
+    {
+        m_device.textScaled(x0, y0, text.c_str(), scale, clr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // textBox()
+    //
+    // Draws a string in a box on the screen, using the current font. The text is
+    // broken in to lines that fit the box - at spaces, or within a word that is
+    // too long for a line - and at newlines. Each line is aligned in the box.
+    //
+    // Only the pixels inside the box are changed.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // x0           The X coordinate of the box - upper left corner
+    // y0           The Y coordinate of the box - upper left corner
+    // width        The width of the box
+    // height       The height of the box
+    // text         The string to draw
+    // align        optional The alignment of the lines - grTextAlignLeft (default),
+    //              grTextAlignCenter or grTextAlignRight
+    // wrap         optional Wrap text to the width of the box. Defaults to true. If false,
+    //              lines only end at a newline, and are clipped to the box.
+    // clr          optional The color value to draw the text. This defaults to white (1).
+
+    void textBox(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, const char *text,
+                 grTextAlign_t align = grTextAlignLeft, bool wrap = true, uint8_t clr = COLOR_WHITE)
+    {
+        m_device.textBox(x0, y0, width, height, text, align, wrap, clr);
+    }
+
+    void textBox(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, String &text,
+                 grTextAlign_t align = grTextAlignLeft, bool wrap = true, uint8_t clr = COLOR_WHITE)
+    {
+        m_device.textBox(x0, y0, width, height, text.c_str(), align, wrap, clr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // render()
+    //
+    // Draws the changed items of a display list to the screen buffer. Only the
+    // regions of the screen covered by changed items are redrawn. Call display()
+    // to send the results to the device.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theList      The display list to render
+
+    void render(QwiicDisplayList &theList)
+    {
+        theList.render(m_device);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // render()
+    //
+    // Draws the changed sprites of a sprite layer to the screen buffer. The
+    // graphics under a moved sprite are restored, and the sprite is drawn at
+    // its new location. Call display() to send the results to the device.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theLayer     The sprite layer to render
+
+    void render(QwiicSpriteLayer &theLayer)
+    {
+        theLayer.update(m_device);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // render()
+    //
+    // Renders a number field to the screen. Only the characters of the field
+    // that changed since it was last rendered are redrawn.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // theField     The number field to render
+
+    void render(QwiicNumberField &theField)
+    {
+        theField.update(m_device);
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // Methods to support Arduino Print  capability
     ///////////////////////////////////////////////////////////////////////
@@ -749,6 +1263,8 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
             return;
 
         m_cursorX = x;
+        m_utf8Len = 0;
+        m_prevCode = 0;
         m_cursorY = y;
     }
 
@@ -782,44 +1298,288 @@ template <typename DeviceType> class QwiicOLEDBaseClass : public Print // NOTE:
         return m_color;
     }
 
+    ///////////////////////////////////////////////////////////////////////
+    // setConsole()
+    //
+    // Enables or disables console mode. In console mode, print output that reaches the
+    // bottom of the screen scrolls the screen up a line, rather than starting over at
+    // the top. Text lines are placed on a grid of the font height.
+    //
+    // On devices where the display shows the full screen buffer (the 128x64 SSD1306
+    // boards), the scroll is done by moving the display start line - a new line sends
+    // the cleared line and one command, not the whole screen. This needs a font height
+    // that evenly divides the screen height. Otherwise the screen buffer is copied up a
+    // line.
+    //
+    // The screen is erased and the cursor moved to the top left when the mode changes.
+    // While the display is scrolled, only print output follows the scroll - other
+    // graphics are drawn at screen buffer positions. A font change that puts the scroll
+    // off the line grid of the new font starts over at the top of an erased screen.
+    //
+    // Console mode isn't available while a virtual canvas is set - the canvas is taller
+    // than the screen. It stays disabled.
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // enable       true - enable console mode, false - disable
+    // retval       true if the hardware scroll is used
+
+    bool setConsole(bool enable)
+    {
+        erase();
+        m_console = enable && !m_device.virtualCanvas();
+        m_consoleTop = 0;
+        m_startPending = false;
+        m_device.setStartLine(0);
+
+        QwiicFont *pFont = m_device.font();
+        m_consoleHW = m_console && pFont && pFont->height && !(m_device.height() % pFont->height) &&
+                      m_device.setStartLine(0);
+
+        m_cursorX = m_cursorY = 0;
+        m_utf8Len = 0;
+        m_prevCode = 0;
+
+        return m_consoleHW;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // getConsole()
+    //
+    // Returns true if console mode is enabled
+    //
+    // Parameter    Description
+    // ---------    -----------------------------
+    // retval       true if console mode is enabled
+
+    bool getConsole(void)
+    {
+        return m_console;
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // write()
     //
     // For the Arduino Print interface
     //
+    // Text is UTF-8. The bytes of a character split across writes are held until
+    // the character is complete.
+
+    using Print::write; // keep the Print write(string) methods
 
     virtual size_t write(uint8_t theChar)
+    {
+        return write(&theChar, 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // write()
+    //
+    // For the Arduino Print interface - write a buffer of text. print(), println()
+    // and printf() output arrives here.
+    //
+    // The text is laid out and drawn as runs - the characters up to a newline or to
+    // the wrap point at the right of the screen are drawn with one call to text().
+
+    virtual size_t write(const uint8_t *buffer, size_t size)
     {
         QwiicFont *pFont = m_device.font();
 
-        if (!pFont) // no Font?! No dice
+        if (!pFont || !buffer) // no Font?! No dice
             return 0;
 
-        switch (theChar)
+        const char *pText = (const char *)buffer;
+        size_t nText = size;
+
+        // Finish a UTF-8 character started by an earlier write
+        if (m_utf8Len)
         {
-        case '\n': // Carriage return
-            m_cursorX = 0;
-            m_cursorY += pFont->height;
-        case '\r': // Line feed - do nothing
+            while (nText && m_utf8Len < m_utf8Need && (*pText & 0xC0) == 0x80)
+            {
+                m_utf8[m_utf8Len++] = *pText++;
+                nText--;
+            }
+            if (m_utf8Len < m_utf8Need && !nText) // still waiting
+                return size;
+
+            // complete - or cut short, and the lead byte is drawn as is
+            m_utf8[m_utf8Len] = '\0';
+            writeText(pFont, m_utf8, m_utf8Len);
+            m_utf8Len = 0;
+        }
+
+        // Hold back a UTF-8 character that is split at the end of the buffer
+        uint8_t nHold = 0, need;
+        for (uint8_t i = 1; i <= 3 && i <= nText; i++)
+        {
+            uint8_t lead = pText[nText - i];
+            if ((lead & 0xC0) == 0x80) // continuation byte - keep looking for the lead
+                continue;
+
+            need = (lead < 0xC2 || lead > 0xF4 ? 1 : (lead < 0xE0 ? 2 : (lead < 0xF0 ? 3 : 4)));
+            if (need > i)
+            {
+                nHold = i;
+                m_utf8Need = need;
+            }
             break;
-        default:
+        }
+        writeText(pFont, pText, nText - nHold);
 
-            char buffer[2] = {theChar, '\0'}; // text() needs a c string
-            m_device.text(m_cursorX, m_cursorY, buffer, m_color);
+        for (m_utf8Len = 0; m_utf8Len < nHold; m_utf8Len++)
+            m_utf8[m_utf8Len] = pText[nText - nHold + m_utf8Len];
+
+        return size;
+    }
 
-            m_cursorX += pFont->width + 1;
+  private:
+    ///////////////////////////////////////////////////////////////////////
+    // writeText()
+    //
+    // Lay out and draw text at the cursor. The text is walked once, measuring each
+    // glyph - the same metrics text() uses. A run of text is drawn when a newline is
+    // found, or when the line is full (the text wraps), or at the end of the text.
+    //
+    // The cursor moves to the next line right after the character that fills the line -
+    // once the line can't hold another character of the font width - so a newline
+    // written after a full line leaves a blank line.
 
-            if (m_cursorX > m_device.width() - pFont->width)
-            { // overflow
-                m_cursorX = 0;
-                m_cursorY += pFont->height;
+    void writeText(QwiicFont *pFont, const char *text, uint16_t length)
+    {
+        const char *pText = text, *pEnd = text + length, *pRun = text, *pChar;
+        int16_t x = m_cursorX, xRun = x; // pen position, start of the run
+        uint16_t code;
+        QwGlyph theGlyph;
+
+        // A scrolled console with lines off the grid of this font (the font changed) - a
+        // line would run past the end of the screen buffer
+        if (pFont->height && m_consoleTop % pFont->height)
+            consoleRestart();
+
+        while (pText < pEnd)
+        {
+            if (*pText == '\n' || *pText == '\r')
+            {
+                m_device.text(xRun, textY(), pRun, pText - pRun, m_color);
+
+                if (*pText == '\n') // Carriage return. Line feed ('\r') - do nothing
+                    newLine(pFont);
+                else
+                    m_cursorX = x > 0 ? x : 0;
+
+                x = xRun = m_cursorX;
+                m_prevCode = 0;
+                pRun = ++pText;
+                continue;
+            }
+            pChar = pText;
+            code = qwNextCode(pText);
+
+            pFont->glyph(code, theGlyph); // blank if not in the font
+
+            if (m_prevCode)
+            {
+                x += pFont->kerning(m_prevCode, code);
+                if (pChar == pRun) // kerning with the last character of an earlier write
+                    xRun = x > 0 ? x : 0;
+            }
+
+            // wrap?
+            if (x + theGlyph.xOffset + theGlyph.width > m_device.width() && (pChar > pRun || x > 0))
+            {
+                m_device.text(xRun, textY(), pRun, pChar - pRun, m_color);
+                newLine(pFont);
+
+                x = xRun = m_cursorX;
+                pRun = pChar;
+            }
+            x += theGlyph.advance;
+            m_prevCode = code;
+
+            // line full?
+            if (x > m_device.width() - pFont->width)
+            {
+                m_device.text(xRun, textY(), pRun, pText - pRun, m_color);
+                newLine(pFont);
+
+                x = xRun = m_cursorX;
+                m_prevCode = 0;
+                pRun = pText;
             }
-            break;
         }
+        m_device.text(xRun, textY(), pRun, pEnd - pRun, m_color);
+
+        m_cursorX = x <= 0 ? 0 : (x > 255 ? 255 : x);
+    }
+
+    // Move the cursor to the start of the next line - back to the top if off the screen
+    void newLine(QwiicFont *pFont)
+    {
+        m_cursorX = 0;
+
+        if (m_console)
+        {
+            consoleLine(pFont->height);
+            return;
+        }
+        m_cursorY += pFont->height;
+
         if (m_cursorY >= m_device.height()) // check for overflow
             m_cursorY = 0;
+    }
 
-        return 1;
+    // The screen buffer row to draw the cursor line at - follows a console scroll
+    uint8_t textY(void)
+    {
+        return (m_cursorY + m_consoleTop) % m_device.height();
+    }
+
+    // Console mode - move the cursor to the next line on the grid, scrolling up a line
+    // at the bottom of the screen
+    void consoleLine(uint8_t lineHeight)
+    {
+        uint8_t height = m_device.height();
+        uint8_t nLines = lineHeight ? height / lineHeight : 0;
+
+        if (!nLines)
+            return;
+
+        uint8_t line = m_cursorY / lineHeight + 1;
+        if (line < nLines)
+        {
+            m_cursorY = line * lineHeight;
+            return;
+        }
+        m_cursorY = (nLines - 1) * lineHeight;
+
+        grRasterOp_t rop = m_device.rasterOp();
+        m_device.setRasterOp(grROPCopy);
+
+        if (m_consoleHW && !(height % lineHeight) && !(m_consoleTop % lineHeight))
+        {
+            // The top line moves to the bottom of the display - clear it and move the
+            // start line down. The cleared line is the only data sent.
+            m_device.rectangleFillSolid(0, m_consoleTop, m_device.width(), lineHeight, 0);
+            m_consoleTop = (m_consoleTop + lineHeight) % height;
+            m_startPending = true;
+        }
+        else if (m_consoleTop)
+            consoleRestart();
+        else
+        {
+            m_device.copyRect(0, lineHeight, m_device.width(), m_cursorY, 0, 0);
+            m_device.rectangleFillSolid(0, m_cursorY, m_device.width(), height - m_cursorY, 0);
+        }
+        m_device.setRasterOp(rop);
+    }
+
+    // Console mode - the font no longer fits the scrolled display. Start over at the top.
+    void consoleRestart(void)
+    {
+        m_device.erase();
+        m_consoleTop = 0;
+        m_startPending = true;
+        m_cursorY = 0;
     }
 };
 
@@ -221,20 +221,134 @@ bool QwGrBufferDevice::getStringSize(const char *text, uint16_t &width, uint16_t
     if (!m_currentFont || !text)
         return false;
 
-    int sLen = strlen(text);
+    // Sum the advance of each glyph - and kerning - the same metrics used to draw
+    QwGlyph theGlyph;
+    int16_t x = 0;
+    uint16_t code, prevCode = 0;
 
-    width = sLen * m_currentFont->width;
+    for (const char *pText = text; *pText;)
+    {
+        code = qwNextCode(pText); // UTF-8
+
+        m_currentFont->glyph(code, theGlyph); // blank if not in the font
 
-    // The 5x7 font width is off by one - historical - was same in orig lib, which fonts
-    // are used.
-    if (m_currentFont == &QW_FONT_5X7)
-        width += sLen;
+        if (prevCode)
+            x += m_currentFont->kerning(prevCode, code);
+        prevCode = code;
+
+        x += theGlyph.advance;
+    }
+    width = x > 0 ? x : 0;
 
-    height = (sLen > 0 ? m_currentFont->height : 0);
+    height = (*text ? m_currentFont->height : 0);
 
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////
+// Clipping
+////////////////////////////////////////////////////////////////////////////////////////
+// setClipRect()
+//
+// Limit drawing to the given rectangle. The rect is intersected with the viewport,
+// and the render routines of the device use the result when rasterizing.
+
+void QwGrBufferDevice::setClipRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+{
+    // Off screen or empty? Nothing would be drawn - but keep the bounds sane
+    if (!width || !height || x0 >= m_viewport.width || y0 >= m_viewport.height)
+    {
+        // an "inside out" rect - x0 > x1 - rejects every pixel
+        m_clipX0 = m_clipY0 = 1;
+        m_clipX1 = m_clipY1 = 0;
+        return;
+    }
+    m_clipX0 = x0;
+    m_clipY0 = y0;
+
+    // use a wide type - x0 + width can wrap a byte
+    uint16_t x1 = (uint16_t)x0 + width - 1;
+    uint16_t y1 = (uint16_t)y0 + height - 1;
+
+    m_clipX1 = (x1 >= m_viewport.width ? m_viewport.width - 1 : x1);
+    m_clipY1 = (y1 >= m_viewport.height ? m_viewport.height - 1 : y1);
+}
+////////////////////////////////////////////////////////////////////////////////////////
+// clearClipRect()
+//
+// Reset the clip region to the full viewport
+
+void QwGrBufferDevice::clearClipRect(void)
+{
+    m_clipX0 = 0;
+    m_clipY0 = 0;
+    m_clipX1 = m_viewport.width ? m_viewport.width - 1 : 0;
+    m_clipY1 = m_viewport.height ? m_viewport.height - 1 : 0;
+}
+////////////////////////////////////////////////////////////////////////////////////////
+// clipRect()
+//
+// Return the current clip region. An empty clip region has a width of 0
+
+QwRect QwGrBufferDevice::clipRect(void)
+{
+    QwRect rect = {m_clipX0, m_clipY0, 0, 0};
+
+    if (m_clipX1 >= m_clipX0 && m_clipY1 >= m_clipY0)
+    {
+        rect.width = m_clipX1 - m_clipX0 + 1;
+        rect.height = m_clipY1 - m_clipY0 + 1;
+    }
+    return rect;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// setFillPattern()
+//
+// Set the pattern used by the filled draw methods. The pattern is copied. It's fixed
+// to the screen, not the shape, so fills next to each other line up. A nullptr
+// restores solid fills.
+
+void QwGrBufferDevice::setFillPattern(const uint8_t *pPattern)
+{
+    if (!pPattern)
+    {
+        m_pFillPattern = nullptr;
+        return;
+    }
+    memcpy(m_fillPattern, pPattern, kFillPatternSize);
+    m_pFillPattern = m_fillPattern;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// setFillDither()
+//
+// Set an ordered dither fill pattern. A pixel is drawn if its entry in the 8x8 Bayer
+// matrix is below the level, so level n draws n of every 64 pixels, spread evenly.
+// kFillDitherMax (or above) restores solid fills.
+
+static const uint8_t bayer8x8[kByteNBits][kByteNBits] = { // [row][column]
+    {0, 32, 8, 40, 2, 34, 10, 42},   {48, 16, 56, 24, 50, 18, 58, 26}, {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22}, {3, 35, 11, 43, 1, 33, 9, 41},   {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},   {63, 31, 55, 23, 61, 29, 53, 21}};
+
+void QwGrBufferDevice::setFillDither(uint8_t level)
+{
+    if (level >= kFillDitherMax)
+    {
+        m_pFillPattern = nullptr;
+        return;
+    }
+    for (uint8_t x = 0; x < kByteNBits; x++)
+    {
+        m_fillPattern[x] = 0;
+        for (uint8_t y = 0; y < kByteNBits; y++)
+            if (bayer8x8[y][x] < level)
+                m_fillPattern[x] |= byte_bits[y];
+    }
+    m_pFillPattern = m_fillPattern;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////
 // Public Graphics Methods
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -348,7 +462,7 @@ void QwGrBufferDevice::rectangle(uint8_t x0, uint8_t y0, uint8_t width, uint8_t
     if (width <= 1 || height <= 1)
     {
         // this is a line
-        line(x0, y0, x0 + width - 1, y0 + height - 1);
+        line(x0, y0, x0 + width - 1, y0 + height - 1, clr);
         return;
     }
 
@@ -390,11 +504,11 @@ void QwGrBufferDevice::drawRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t h
 
 void QwGrBufferDevice::rectangleFill(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
 {
-    // Is this a line?
-    if (width <= 1 || height <= 1)
+    // Is this a line? A patterned fill still goes to the fill routine
+    if ((width <= 1 || height <= 1) && !(m_pFillPattern && width && height))
     {
         // this is a line
-        line(x0, y0, x0 + width - 1, y0 + height - 1);
+        line(x0, y0, x0 + width - 1, y0 + height - 1, clr);
         return;
     }
     // bounds check
@@ -405,6 +519,21 @@ void QwGrBufferDevice::rectangleFill(uint8_t x0, uint8_t y0, uint8_t width, uint
 
     (*m_idraw.drawRectFilled)(this, x0, y0, width, height, clr);
 }
+
+////////////////////////////////////////////////////////////////////////////////////////
+// rectangleFillSolid()
+//
+// Fill a rectangle, ignoring the fill pattern. Used to clear areas - a patterned clear
+// would leave the pixels outside of the pattern behind.
+
+void QwGrBufferDevice::rectangleFillSolid(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
+{
+    const uint8_t *pPattern = m_pFillPattern;
+
+    m_pFillPattern = nullptr;
+    rectangleFill(x0, y0, width, height, clr);
+    m_pFillPattern = pPattern;
+}
 ////////////////////////////////////////////////////////////////////////////////////////
 // drawRectFill()
 //
@@ -560,20 +689,162 @@ void QwGrBufferDevice::bitmap(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t
 void QwGrBufferDevice::bitmap(uint8_t x0, uint8_t y0, QwBitmap &theBMP)
 {
     // just pass to graphics device
-    (*m_idraw.drawBitmap)(this, x0, y0, theBMP.width, theBMP.height, (uint8_t *)theBMP.data(), theBMP.width,
-                          theBMP.height);
+    bitmap(x0, y0, (uint8_t *)theBMP.data(), theBMP.width, theBMP.height, theBMP.format);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// bitmap() - bitmap data in the given format
+//
+void QwGrBufferDevice::bitmap(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height,
+                              grBitmapFormat_t format)
+{
+    if (format == grBitmapPage)
+        (*m_idraw.drawBitmap)(this, x0, y0, bmp_width, bmp_height, pBitmap, bmp_width, bmp_height);
+    else if (format == grBitmapRLE)
+        (*m_idraw.drawBitmapRLE)(this, x0, y0, bmp_width, bmp_height, pBitmap, bmp_width, bmp_height);
+    else
+        (*m_idraw.drawBitmapRows)(this, x0, y0, bmp_width, bmp_height, pBitmap, bmp_width, bmp_height, format);
 }
 ////////////////////////////////////////////////////////////////////////////////////////
 // text()
 //
-// Draw a string on the screen using the current font
+// Draw a string on the screen using the current font - all of it, or the first
+// length bytes.
 
 void QwGrBufferDevice::text(uint8_t x0, uint8_t y0, const char *text, uint8_t clr)
 {
     if (!text || x0 >= m_viewport.width || y0 >= m_viewport.height)
         return;
 
-    (m_idraw.drawText)(this, x0, y0, text, clr);
+    (m_idraw.drawText)(this, x0, y0, text, kTextToEnd, clr);
+}
+
+void QwGrBufferDevice::text(uint8_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr)
+{
+    if (!text || !length || x0 >= m_viewport.width || y0 >= m_viewport.height)
+        return;
+
+    (m_idraw.drawText)(this, x0, y0, text, length, clr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+// textBox()
+//
+// Draw text in a box - broken in to lines that fit the width of the box, each aligned
+// in the box. Drawing is clipped to the box, so only the box is changed (and marked
+// dirty).
+//
+// The Plan:
+//   - Lines are measured and broken in one pass - walk the glyphs of the line, summing
+//     the advance and kerning, and note the last space. Once a glyph doesn't fit, the
+//     line breaks at the last space - or before the glyph if the line has no spaces.
+//   - A newline in the text always ends a line. Without wrap, lines only end at a newline.
+//   - Each line is drawn once it's measured - the spaces at a break aren't drawn.
+//   - Drawing stops at the bottom of the box.
+
+void QwGrBufferDevice::textBox(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, const char *text,
+                               grTextAlign_t align, bool wrap, uint8_t clr)
+{
+    if (!m_currentFont)
+        initFont();
+
+    if (!m_currentFont || !text || !width || !height || x0 >= m_viewport.width || y0 >= m_viewport.height)
+        return;
+
+    // Clip to the box - inside the current clip rect
+    uint8_t clipX0 = m_clipX0, clipY0 = m_clipY0, clipX1 = m_clipX1, clipY1 = m_clipY1;
+
+    uint16_t x1 = x0 + width - 1, y1 = y0 + height - 1;
+    if (x0 > m_clipX0)
+        m_clipX0 = x0;
+    if (y0 > m_clipY0)
+        m_clipY0 = y0;
+    if (x1 < m_clipX1)
+        m_clipX1 = x1;
+    if (y1 < m_clipY1)
+        m_clipY1 = y1;
+
+    QwGlyph theGlyph;
+    const char *pLine = text, *pText, *pChar, *pLineEnd, *pBreak, *pNext;
+    uint16_t code, prevCode;
+    int16_t lineWidth, breakWidth, x;
+    uint8_t margin, breakMargin; // space after the last glyph of the line - not used to align
+    uint16_t y = y0;
+
+    while (*pLine && y <= m_clipY1 && m_clipX0 <= m_clipX1 && m_clipY0 <= m_clipY1)
+    {
+        // measure the line - and find where it breaks
+        pText = pLine;
+        pBreak = nullptr;
+        lineWidth = breakWidth = 0;
+        margin = breakMargin = 0;
+        prevCode = 0;
+
+        while (true)
+        {
+            if (!*pText || *pText == '\n')
+            {
+                pLineEnd = pText;
+                pNext = *pText ? pText + 1 : pText;
+                break;
+            }
+            pChar = pText;
+            code = qwNextCode(pText); // UTF-8
+
+            m_currentFont->glyph(code, theGlyph); // blank if not in the font
+
+            if (code == ' ' && prevCode != ' ') // a place to break - before a run of spaces
+            {
+                pBreak = pChar;
+                breakWidth = lineWidth;
+                breakMargin = margin;
+            }
+            if (prevCode)
+                x = lineWidth + m_currentFont->kerning(prevCode, code) + theGlyph.advance;
+            else
+                x = theGlyph.advance;
+
+            if (wrap && x > width && pChar != pLine && code != ' ')
+            {
+                if (pBreak)
+                {
+                    pLineEnd = pBreak;
+                    lineWidth = breakWidth;
+                    margin = breakMargin;
+                    pNext = pBreak;
+                    while (*pNext == ' ') // the spaces at a break aren't drawn
+                        pNext++;
+                }
+                else
+                    pLineEnd = pNext = pChar;
+                break;
+            }
+            lineWidth = x;
+            prevCode = code;
+
+            x = theGlyph.advance - theGlyph.xOffset - theGlyph.width;
+            margin = x > 0 ? x : 0;
+        }
+
+        // draw it
+        if (pLineEnd > pLine)
+        {
+            x = x0;
+            if (align == grTextAlignCenter)
+                x += (width - lineWidth + margin) / 2;
+            else if (align == grTextAlignRight)
+                x += width - lineWidth + margin;
+
+            (m_idraw.drawText)(this, x, y, pLine, pLineEnd - pLine, clr);
+        }
+        pLine = pNext;
+        y += m_currentFont->height;
+    }
+
+    m_clipX0 = clipX0;
+    m_clipY0 = clipY0;
+    m_clipX1 = clipX1;
+    m_clipY1 = clipY1;
 }
 ////////////////////////////////////////////////////////////////////////////////////////
 // draw_test()
@@ -581,49 +852,37 @@ void QwGrBufferDevice::text(uint8_t x0, uint8_t y0, const char *text, uint8_t cl
 // Draw text - one pixel at a time. Based on the algorithm in the Micro OLED
 // Arduino library
 //
-void QwGrBufferDevice::drawText(uint8_t x0, uint8_t y0, const char *text, uint8_t clr)
+void QwGrBufferDevice::drawText(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr)
 {
     // check things
     if (!m_currentFont || !text)
         return;
 
-    int slen = strlen(text);
-
-    if (!slen) // empty string?
-        return;
-
     uint8_t nRows = m_currentFont->height / kByteNBits;
     if (!nRows)
         nRows = 1;
 
-    // 5x7 font is special - need to add a margin
-    uint8_t margin5x7 = (nRows == 1); // For the 5x7 font
-
-    // used in loop
-    uint16_t nRowLen = m_currentFont->map_width / m_currentFont->width; // how long is a
-    uint16_t rowBytes = m_currentFont->map_width * nRows;
-
-    // get font data
-    const uint8_t *pFont = m_currentFont->data();
-
     // vars for the loops ...
-    uint16_t charOffset, fontIndex;
+    QwGlyph theGlyph;
+    const char *pEnd = (length == kTextToEnd ? nullptr : text + length);
+    int16_t x = x0, xGlyph; // pen position, glyph position
+    uint16_t code, prevCode = 0;
     uint8_t rowOffset, currChar, i, j, row;
 
-    // walk the string ... note: doing all loop incs here - to handle continue statement below
-
-    for (int k = 0; k < slen; k++, text++, x0 += m_currentFont->width + margin5x7)
+    // walk the string
+    while ((!pEnd || text < pEnd) && *text)
     {
+        code = qwNextCode(text); // UTF-8
 
-        // index into the font data - takes into account font size, rows span ... etc
-        charOffset = *text - m_currentFont->start;
+        // characters that aren't in the font are blank
+        m_currentFont->glyph(code, theGlyph);
 
-        // does the char location exceed the number of chars in the font?
-        if (charOffset >= m_currentFont->n_chars)
-            continue; // neeeexxxtt!
+        if (prevCode)
+            x += m_currentFont->kerning(prevCode, code);
+        prevCode = code;
 
-        // offset into the font data array - start location
-        fontIndex = (charOffset / nRowLen * rowBytes) + ((charOffset % nRowLen) * m_currentFont->width);
+        xGlyph = x + theGlyph.xOffset;
+        x += theGlyph.advance;
 
         // Now walk the rows of this font entry (it can span bytes)
         for (row = 0; row < nRows; row++)
@@ -631,21 +890,20 @@ void QwGrBufferDevice::drawText(uint8_t x0, uint8_t y0, const char *text, uint8_
 
             rowOffset = row * kByteNBits; // y offset for multi row fonts - used in pixel draw
 
-            // walk the width of the font
-            for (i = 0; i < m_currentFont->width + margin5x7; i++)
+            // walk the width of the glyph
+            for (i = 0; i < theGlyph.width; i++)
             {
-
-                // this is done in a weird way because the 5x7 font has no margin
-                if (margin5x7 && i == m_currentFont->width)
-                    continue; // skip to next
+                if (xGlyph + i < 0 || xGlyph + i >= m_viewport.width)
+                    continue;
 
                 // finally - data!
-                currChar = pgm_read_byte(pFont + fontIndex + i + (row * m_currentFont->map_width));
+                currChar = (theGlyph.inRAM ? theGlyph.pData[i + row * theGlyph.stride]
+                                           : pgm_read_byte(theGlyph.pData + i + row * theGlyph.stride));
 
                 // draw bits
                 for (j = 0; j < kByteNBits; j++)
                     if (currChar & byte_bits[j])
-                        (*m_idraw.drawPixel)(this, x0 + i, y0 + j + rowOffset, clr);
+                        (*m_idraw.drawPixel)(this, xGlyph + i, y0 + j + rowOffset, clr);
 
             } // walk font width
 
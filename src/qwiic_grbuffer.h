@@ -54,6 +54,7 @@
 
 // Include resource definitions
 #include "res/qwiic_resdef.h"
+#include "qwiic_grcommon.h"
 
 // RECT!
 struct QwRect
@@ -84,6 +85,16 @@ extern const uint8_t byte_bits[8];
 //
 #define swap_int(_a_, _b_) (((_a_) ^= (_b_)), ((_b_) ^= (_a_)), ((_a_) ^= (_b_)))
 
+// Length of text to draw - all of the string, up to the terminating null
+#define kTextToEnd 0xFFFF
+
+// Fill patterns - one byte per column, repeating every 8 pixels across the screen. A
+// byte holds 8 rows, bit 0 at the top, repeating down the screen.
+#define kFillPatternSize 8
+
+// Dither fill levels - 0 (nothing drawn) to kFillDitherMax (solid)
+#define kFillDitherMax 64
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // _QwIDraw
 //
@@ -132,7 +143,19 @@ class _QwIDraw
     {
     }
 
-    virtual void drawText(uint8_t x0, uint8_t y0, const char *text, uint8_t clr)
+    virtual void drawText(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr)
+    {
+    }
+
+    // Row major (XBM, PBM) bitmaps
+    virtual void drawBitmapRows(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
+                                uint8_t bmp_height, uint8_t format)
+    {
+    }
+
+    // Run length encoded bitmaps
+    virtual void drawBitmapRLE(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
+                               uint8_t bmp_height)
     {
     }
 };
@@ -142,7 +165,8 @@ typedef void (*QwDrawPntFn)(void *, uint8_t, uint8_t, uint8_t);
 typedef void (*QwDrawTwoPntFn)(void *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t);
 typedef void (*QwDrawCircleFn)(void *, uint8_t, uint8_t, uint8_t, uint8_t);
 typedef void (*QwDrawBitmapFn)(void *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t *, uint8_t, uint8_t);
-typedef void (*QwDrawTextFn)(void *, uint8_t, uint8_t, const char *, uint8_t);
+typedef void (*QwDrawTextFn)(void *, int16_t, uint8_t, const char *, uint16_t, uint8_t);
+typedef void (*QwDrawBitmapRowsFn)(void *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t *, uint8_t, uint8_t, uint8_t);
 
 // Define the vtable struct for IDraw
 struct _QwIDraw_vtable
@@ -157,6 +181,8 @@ struct _QwIDraw_vtable
     QwDrawCircleFn drawCircleFilled;
     QwDrawBitmapFn drawBitmap;
     QwDrawTextFn drawText;
+    QwDrawBitmapRowsFn drawBitmapRows;
+    QwDrawBitmapFn drawBitmapRLE;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +196,9 @@ class QwGrBufferDevice : protected _QwIDraw
 
   public:
     // Constructors
-    QwGrBufferDevice() : m_currentFont{nullptr} {};
+    QwGrBufferDevice()
+        : m_clipX0{0}, m_clipY0{0}, m_clipX1{0}, m_clipY1{0}, m_rop{grROPCopy}, m_pFillPattern{nullptr},
+          m_currentFont{nullptr} {};
     QwGrBufferDevice(uint8_t width, uint8_t height) : QwGrBufferDevice(0, 0, width, height){};
     QwGrBufferDevice(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height) : QwGrBufferDevice()
     {
@@ -184,6 +212,9 @@ class QwGrBufferDevice : protected _QwIDraw
         m_viewport.y = y0;
         m_viewport.width = width;
         m_viewport.height = height;
+
+        // a new viewport resets clipping to the full area
+        clearClipRect();
     };
 
     QwRect viewport(void)
@@ -207,6 +238,36 @@ class QwGrBufferDevice : protected _QwIDraw
         return m_viewport.height;
     };
 
+    // Clipping - drawing operations only touch pixels inside the clip rect.
+    // The clip rect is in viewport coordinates and defaults to the full viewport.
+    void setClipRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height);
+    void clearClipRect(void);
+    QwRect clipRect(void);
+
+    // Raster operation used by the draw methods
+    void setRasterOp(grRasterOp_t rop)
+    {
+        m_rop = rop;
+    }
+
+    grRasterOp_t rasterOp(void)
+    {
+        return m_rop;
+    }
+
+    // Fill pattern used by the filled draw methods - kFillPatternSize bytes, or nullptr
+    // for solid fills. Only pixels set in the pattern are drawn.
+    void setFillPattern(const uint8_t *pPattern);
+
+    // Fill with an ordered (Bayer) dither - level 0 to kFillDitherMax
+    void setFillDither(uint8_t level);
+
+    // The current fill pattern - nullptr for solid fills
+    const uint8_t *fillPattern(void)
+    {
+        return m_pFillPattern;
+    }
+
     // Lifecycle
     virtual bool init(void);
 
@@ -230,17 +291,31 @@ class QwGrBufferDevice : protected _QwIDraw
     void rectangle(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr = 1);
     void rectangleFill(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr = 1);
 
+    // rectangleFill() without the fill pattern - for clearing areas
+    void rectangleFillSolid(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr = 0);
+
     void bitmap(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
                 uint8_t bmp_height);
 
     // draw full bitmap
     void bitmap(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height);
 
+    // draw full bitmap - in the given data format
+    void bitmap(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height,
+                grBitmapFormat_t format);
+
     // Bitmap draw - using a bitmap object
     void bitmap(uint8_t x0, uint8_t y0, QwBitmap &bitmap);
 
     void text(uint8_t x0, uint8_t y0, const char *text, uint8_t clr = 1);
 
+    // draw length bytes of text - a run of a longer string
+    void text(uint8_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr);
+
+    // Text laid out in a box - broken in to lines, aligned and clipped to the box
+    void textBox(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, const char *text,
+                 grTextAlign_t align = grTextAlignLeft, bool wrap = true, uint8_t clr = 1);
+
     // subclass interface
     virtual void display(void) = 0;
     virtual void erase(void) = 0;
@@ -248,6 +323,19 @@ class QwGrBufferDevice : protected _QwIDraw
   protected:
     QwRect m_viewport;
 
+    // Current clip region - inclusive bounds, always inside the viewport
+    uint8_t m_clipX0;
+    uint8_t m_clipY0;
+    uint8_t m_clipX1;
+    uint8_t m_clipY1;
+
+    // current raster operation code
+    grRasterOp_t m_rop;
+
+    // Fill pattern - points at m_fillPattern, or nullptr for solid fills
+    const uint8_t *m_pFillPattern;
+    uint8_t m_fillPattern[kFillPatternSize];
+
     // Internal, fast draw routines - These implement QwIDraw
 
     // Pixels
@@ -266,8 +354,8 @@ class QwGrBufferDevice : protected _QwIDraw
     virtual void drawCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr);
     virtual void drawCircleFilled(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr);
 
-    // Text
-    virtual void drawText(uint8_t x0, uint8_t y0, const char *text, uint8_t clr);
+    // Text - length bytes of text, or up to the null for kTextToEnd
+    virtual void drawText(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr);
 
     // Our drawing interface - open to sub-classes ...
     _QwIDraw_vtable m_idraw;
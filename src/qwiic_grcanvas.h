@@ -0,0 +1,108 @@
+
+// qwiic_grcanvas.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//
+// Offscreen canvas.
+//
+// A canvas is a page organized graphics buffer that isn't connected to a device. It
+// supports the full drawing API, using the same drawing kernels as the display devices.
+//
+// Complex graphics can be drawn to a canvas once, and then copied to a display with
+// copyRect() - using the display's clip rect and raster op - when needed.
+
+#pragma once
+
+#include "qwiic_grpage.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// QwCanvas
+//
+// A canvas using a buffer provided by the caller. The buffer must hold
+// width * (height + 7)/8 bytes.
+
+class QwCanvas : public QwGrPageDevice
+{
+  public:
+    QwCanvas(uint8_t width, uint8_t height, uint8_t *pBuffer) : QwGrPageDevice(0, 0, width, height)
+    {
+        // No device to wait on - the canvas is ready to use once created
+        setBuffer(pBuffer);
+        init();
+    }
+
+    bool init(void);
+
+  protected:
+    // For sub-classes that provide the buffer - they must call setBuffer() and init()
+    QwCanvas(uint8_t width, uint8_t height) : QwGrPageDevice(0, 0, width, height)
+    {
+    }
+
+    // A canvas has no device - display() just marks the dirty tiles clean
+    void transferRun(uint8_t page, uint8_t x0, uint8_t *pData, uint8_t nData)
+    {
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// QwCanvasBuffer
+//
+// A canvas that contains its buffer. Example:
+//
+//      QwCanvasBuffer<64, 32> myCanvas;
+
+template <uint8_t W, uint8_t H>
+class QwCanvasBuffer : public QwCanvas
+{
+  public:
+    QwCanvasBuffer() : QwCanvas(W, H)
+    {
+        setBuffer(m_canvasBuffer);
+        init();
+    }
+
+  private:
+    // Graphics buffer for this canvas
+    uint8_t m_canvasBuffer[W * ((H + kByteNBits - 1) / kByteNBits)];
+};
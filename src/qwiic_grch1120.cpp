@@ -57,65 +57,9 @@
 //////////////////////////////////////////////////////////////////////////////////
 // Screen Buffer
 //
-// A key feature of this library is that it only sends "dirty" pixels to the
-// device, minimizing data transfer over the I2C bus. To accomplish this, the
-// dirty range of each graphics buffer page (see device memory layout in the
-// datasheet) is maintained during drawing operation. Whe data is sent to the
-// device, only the pixels in these regions are sent to the device, not the
-// entire page of data.
-//
-// The below macros are used to manage the record keeping of dirty page ranges.
-// Given that these actions are taking place in the draw loop, macros are used
-// for performance considerations.
-//
-// These macros work with the pageState_t struct type.
-//
-// Define unique values just outside of the screen buffer (valid is 0 - 159)
-
-#define kPageMin -1  // outside bounds - low value
-#define kPageMax 160 // outside bounds - high value
-
-// clean/ no settings in the page
-#define pageIsClean(_page_) (_page_.xmin == kPageMax)
-
-// Macro to reset page descriptor
-#define pageSetClean(_page_)                                                                                           \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        _page_.xmin = kPageMax;                                                                                        \
-        _page_.xmax = kPageMin;                                                                                        \
-    } while (false)
-
-// Macro to check and adjust record bounds based on a single location
-#define pageCheckBounds(_page_, _x_)                                                                                   \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        if (_x_ < _page_.xmin)                                                                                         \
-            _page_.xmin = _x_;                                                                                         \
-        if (_x_ > _page_.xmax)                                                                                         \
-            _page_.xmax = _x_;                                                                                         \
-    } while (false)
-
-// Macro to check and adjust record bounds using another page descriptor
-#define pageCheckBoundsDesc(_page_, _page2_)                                                                           \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        if (_page2_.xmin < _page_.xmin)                                                                                \
-            _page_.xmin = _page2_.xmin;                                                                                \
-        if (_page2_.xmax > _page_.xmax)                                                                                \
-            _page_.xmax = _page2_.xmax;                                                                                \
-    } while (false)
-
-// Macro to check and adjust record bounds using bounds values
-#define pageCheckBoundsRange(_page_, _x0_, _x1_)                                                                       \
-    do                                                                                                                 \
-    {                                                                                                                  \
-        if (_x0_ < _page_.xmin)                                                                                        \
-            _page_.xmin = _x0_;                                                                                        \
-        if (_x1_ > _page_.xmax)                                                                                        \
-            _page_.xmax = _x1_;                                                                                        \
-    } while (false)
+// Size of a screen buffer page on the CH1120 (valid is 0 - 159)
 
+#define kPageMax 160
 
 /////////////////////////////////////////////////////////////////////////////
 // Device Commands
@@ -206,40 +150,6 @@
 #define kDefaultVCOMDeselect             ((uint8_t)0x3F) // default
 #define kDefaultExternalIREF             ((uint8_t)0x02)
 
-////////////////////////////////////////////////////////////////////////////////////
-// Pixel write/set operations
-//
-// Using LAMBDAs to create fast raster write/set operations. Using this pattern
-// eleminates the need for switch/if statements in each draw routine. This is
-// basically classic ROPs'
-//
-// NOTE - the order in the arrays is based on grRasterOp_t enum
-//
-// The Graphic operator functions (ROPS)
-//      - Copy      - copy the pixel value in to the buffer (default)
-//      - Not Copy  - copy the not of the pixel value to buffer
-//      - Not       - Set the buffer value to not it's current value
-//      - XOR       - XOR of color and current pixel value
-//      - Black     - Set value to always be black
-//      - White     - set value to always be white
-
-typedef void (*rasterOPsFn)(uint8_t *dest, uint8_t src, uint8_t mask);
-
-static const rasterOPsFn m_rasterOps[] = {
-    // COPY
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | (src & mask); },
-    // NOT COPY
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((!src) & mask); },
-    // NOT DEST
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((!(*dst)) & mask); },
-    // XOR
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((*dst ^ src) & mask); },
-    // Always Black
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = ~mask & *dst; },
-    // Always White
-    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = mask | *dst; }};
-
-
 /////////////////////////////////////////////////////////////////////////////
 // Map for scrolling. See qwiic_grcommon.h for original definitions and descriptions
 /////////////////////////////////////////////////////////////////////////////
@@ -267,7 +177,6 @@ const std::map<uint8_t, uint8_t> scrollIntervals = {
 void QwGrCH1120::setupDefaults(void)
 {
     default_address = {0};
-    m_pBuffer = {nullptr};
     m_color = {1};
     m_rop = {grROPCopy};
     m_i2cBus = {nullptr};
@@ -321,8 +230,8 @@ bool QwGrCH1120::init(void)
     // By default, we are operating this device in "rotate 90" mode with "horizontal addressing"
     // Each "page" is a byte representing 8 pixels
     // so the number of pages that it takes to span entire row is the width divided by the number of bits in a byte
-    m_nPages = m_viewport.width / kByteNBits;  // width / number of pixels per byte.
-                                               // TODO - support multiples != 8
+    if (!setPageCount(m_viewport.width / kByteNBits)) // width / number of pixels per byte.
+        return false;                                 // TODO - support multiples != 8
 
     // init the graphics buffers
     initBuffers();
@@ -409,8 +318,8 @@ void QwGrCH1120::setupOLEDDevice(bool clearDisplay){
     sendDevCommand(kCmdContrastControl, m_initContrast);
     sendDevCommand(kCmdGrayMono, kDefaultMonoMode);
     sendDevCommand(kCmdHorizAddressing, kDefaultHorizontalAddressing);
-    sendDevCommand(kCmdSegRemapDown);
-    sendDevCommand(kCmdComOutScan0First);
+    sendDevCommand(m_rotation & 0x02 ? kCmdSegRemapUp : kCmdSegRemapDown); // 180 and 270 degrees flip the device
+    sendDevCommand(m_rotation & 0x02 ? kCmdComOutScan0Last : kCmdComOutScan0First);
     sendDevCommand(kCmdDisplayRotation, kDefaultRotateDisplayNinety);
     sendDevCommand(kCmdDisableEntireDisplay);
 
@@ -440,22 +349,6 @@ void QwGrCH1120::setCommBus(QwI2C &theBus, uint8_t id_bus)
     m_i2cAddress = id_bus;
 }
 
-////////////////////////////////////////////////////////////////////////////////////
-// setBuffer()
-//
-// Protected method - used by sub-class to set the graphics buffer array.
-//
-// The subclass knows the size of the specific device, so it statically defines
-// the graphics buffer array. The buffer is often set in the subclasses
-// on_initialize() method.
-//
-//
-void QwGrCH1120::setBuffer(uint8_t *pBuffer)
-{
-    if (pBuffer)
-        m_pBuffer = pBuffer;
-}
-
 ////////////////////////////////////////////////////////////////////////////////////
 // clearScreenBuffer()
 //
@@ -477,23 +370,11 @@ void QwGrCH1120::clearScreenBuffer(void)
 // initBuffers()
 //
 // Will clear the local graphics buffer, and the devices screen buffer. Also
-// resets page state descriptors to a "clean" state.
+// resets the tile maps to a "clean" state.
 void QwGrCH1120::initBuffers(void)
 {
-    int i;
-
-    // clear out the local graphics buffer
-    if (m_pBuffer)
-        memset(m_pBuffer, 0, m_viewport.width * m_nPages);
-
-    // Set page descs to "clean" state
-    for (i = 0; i < m_nPages; i++)
-    {
-        pageSetClean(m_pageState[i]);
-        pageSetClean(m_pageErase[i]);
-    }
-
-    m_pendingErase = false;
+    // clear out the local graphics buffer and tile maps
+    clearBuffers();
 
     // clear out the screen buffer
     clearScreenBuffer();
@@ -503,15 +384,13 @@ void QwGrCH1120::initBuffers(void)
 // resendGraphics()
 //
 // Re-send the region in the graphics buffer (local) that contains drawn
-// graphics. This region is defined by the contents of the m_pageErase
-// descriptors.
+// graphics. This region is defined by the contents of the erase tile map.
 //
 
 void QwGrCH1120::resendGraphics(void)
 {
-    // Set the page state dirty bounds to the bounds of erase state
-    for (int i = 0; i < m_nPages; i++)
-        m_pageState[i] = m_pageErase[i];
+    // Set the dirty tiles to the tiles of the erase map
+    markDrawnDirty();
 
     display(); // push bits to screen buffer
 }
@@ -538,7 +417,7 @@ void QwGrCH1120::flipHorz(bool bFlip){
         // If we are flipping to horizontal, we need to adjust row start and end to the end of the display memory
         // This is because when we horizontally flip, if our viewport is smaller than the total area, we will flip in some garbage
         // When flipping we need to offset by the max width minus the viewport width (maybe should be height, may have to update with non-square display)
-        horz_flip_offset = kMaxCH1120Width - m_viewport.width;
+        horz_flip_offset = kMaxCH1120Width - panelWidth();
 
         sendDevCommand(kCmdSegRemapUp);
     }
@@ -554,6 +433,46 @@ void QwGrCH1120::flipHorz(bool bFlip){
     resendGraphics();
 }
 
+////////////////////////////////////////////////////////////////////////////////////
+// setRotation()
+//
+// Rotate the display by quarter turns - 0, 1, 2 or 3 for 0, 90, 180 and 270 degrees
+// clockwise.
+//
+// 180 degrees is done by the device, with the segment remap and COM scan direction
+// reversed. The device rotation command is left at the 90 degree setting the screen
+// buffer addressing of this driver is built on, so 90 and 270 degrees transpose the
+// graphics buffer - each tile is turned as it's sent. 270 is 90 plus the device flip.
+bool QwGrCH1120::setRotation(uint8_t rotation)
+{
+    rotation &= 0x03;
+
+    if (!m_isInitialized || !setTransposed(rotation & 0x01))
+        return false;
+
+    m_rotation = rotation;
+
+    horz_flip_offset = m_rotation & 0x02 ? kMaxCH1120Width - panelWidth() : 0;
+    sendDevCommand(m_rotation & 0x02 ? kCmdSegRemapUp : kCmdSegRemapDown);
+    sendDevCommand(m_rotation & 0x02 ? kCmdComOutScan0Last : kCmdComOutScan0First);
+
+    clearScreenBuffer();
+    resendGraphics();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setStartLine()
+//
+// The device is driven rotated 90 degrees, so its start line moves the graphics
+// horizontally - a vertical start line isn't supported. Always returns false, and
+// nothing is sent - so console mode copies the screen up a line instead.
+bool QwGrCH1120::setStartLine(uint8_t line)
+{
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 // invert()
 //
@@ -669,308 +588,6 @@ void QwGrCH1120::displayPower(bool enable)
     sendDevCommand((enable ? kCmdDisplayOn : kCmdDisplayOff));
 }
 
-////////////////////////////////////////////////////////////////////////////////////
-// Drawing Methods
-
-////////////////////////////////////////////////////////////////////////////////////
-// erase()
-//
-// Erase the graphics that are on screen and anything that's been draw but
-// haven't been sent to the screen.
-//
-
-// This function sort of becomes useless because the entire page is rewritten each time now, so there isn't so much a concept of "erasing"
-void QwGrCH1120::erase(void)
-{
-    if (!m_pBuffer)
-        return;
-
-    // Cleanup the dirty parts of each page in the graphics buffer.
-    for (uint8_t i = 0; i < m_nPages; i++)
-    {
-        // The current "dirty" areas of the graphics [local] buffer.
-        // Areas that haven't been sent to the screen/device but are
-        // "dirty"
-        //
-        // Add the areas with pixels set and have been sent to the
-        // device - this is the contents of m_pageErase
-        pageCheckBoundsDesc(m_pageState[i], m_pageErase[i]);
-
-        // if this page is clean, there is nothing to update
-        if (pageIsClean(m_pageState[i]))
-            continue;
-
-
-        // clear out memory that is dirty on this page
-        memset(m_pBuffer + i * m_viewport.width + m_pageState[i].xmin, 0,
-               m_pageState[i].xmax - m_pageState[i].xmin + 1); // add one b/c values are 0 based
-
-        // clear out any pending dirty range for this page - it's erased
-        pageSetClean(m_pageState[i]);
-    }
-
-    // Indicate that the data transfer to the device should include the erase
-    // region
-    m_pendingErase = true;
-}
-
-////////////////////////////////////////////////////////////////////////////////////
-//
-// draw_pixel()
-//
-// Used to set a pixel in the graphics buffer - uses the current write operator
-// function
-//
-
-void QwGrCH1120::drawPixel(uint8_t x, uint8_t y, uint8_t clr)
-{
-    // quick sanity check on range
-    if (x >= m_viewport.width || y >= m_viewport.height)
-        return; // out of bounds
-
-    uint8_t bit = byte_bits[mod_byte(y)];
-
-    m_rasterOps[m_rop](m_pBuffer + x + y / kByteNBits * m_viewport.width, // pixel offset
-                       (clr ? bit : 0), bit);                             // which bit to set in byte
-    
-    // print Buffer after drawing pixel:
-    pageCheckBounds(m_pageState[y / kByteNBits],
-                x); // update dirty range for page
-}
-
-////////////////////////////////////////////////////////////////////////////////////
-// draw_line_horz()
-//
-// Fast horizontal line drawing routine
-//
-void QwGrCH1120::drawLineHorz(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
-{
-    // Basically we set a bit within a range in a page of our graphics buffer.
-
-    // in range
-    if (y0 >= m_viewport.height)
-        return;
-
-    if (x0 > x1)
-        swap_int(x0, x1);
-
-    if (x1 >= m_viewport.width)
-        x1 = m_viewport.width - 1;
-
-    uint8_t bit = byte_bits[mod_byte(y0)];   // bit to set
-    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
-
-    // Get the start of this line in the graphics buffer
-    uint8_t *pBuffer = m_pBuffer + x0 + y0 / kByteNBits * m_viewport.width;
-
-    // walk up x and set the target pixel using the pixel operator function
-    for (int i = x0; i <= x1; i++, pBuffer++)
-        curROP(pBuffer, (clr ? bit : 0), bit);
-
-    // Mark the page dirty for the range drawn
-    pageCheckBoundsRange(m_pageState[y0 / kByteNBits], x0, x1);
-}
-
-////////////////////////////////////////////////////////////////////////////////////
-// draw_line_vert()
-//
-// Fast vertical line drawing routine - also supports fast filled rects
-//
-void QwGrCH1120::drawLineVert(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
-{
-    if (x0 >= m_viewport.width) // out of bounds
-        return;
-
-    // want an accending order
-    if (y0 > y1)
-        swap_int(y0, y1);
-
-    // keep on screen
-    if (y1 >= m_viewport.height)
-        y1 = m_viewport.height - 1;
-
-    uint8_t startBit, endBit, setBits;
-
-    // Get the start and end pages we are writing to
-    uint8_t page0 = y0 / kByteNBits;
-    uint8_t page1 = y1 / kByteNBits;
-
-    // loop over the pages. For each page determine the range of pixels
-    // to set in the target page byte and then set them using the current
-    // pixel operator function
-
-    // Note: This function can also be used to draw filled rects - just iterate
-    //       in the x direction. The base rect fill (in grBuffer) calls this
-    //       method x1-x0 times, and each of those calls has some overhead. So
-    //       just iterating over each page - x1-x0 times here - saves overhead
-    //       costs.
-    //
-    //       To make this work, make sure x0 > x1. Also, this method is wired in
-    //       as the draw_rect_filled entry in the draw interface. This is done
-    //       above in the init process.
-
-    int xinc;
-    if (x0 > x1)
-        swap_int(x0, x1);
-
-    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
-
-    for (int i = page0; i <= page1; i++)
-    {
-        startBit = mod_byte(y0); // start bit in this byte
-
-        // last bit of this byte to set? Does the line end in this byte, or continue
-        // on...
-        endBit = y0 + kByteNBits - startBit > y1 ? mod_byte(y1) : kByteNBits - 1;
-
-        // Set the bits from startBit to endBit
-        setBits = (0xFF >> ((kByteNBits - endBit) - 1)) << startBit; // what bits are being set in this byte
-
-        // set the bits in the graphics buffer using the current byte operator
-        // function
-
-        // Note - We iterate over x to fill in a rect if specified.
-        for (xinc = x0; xinc <= x1; xinc++)
-            curROP(m_pBuffer + i * m_viewport.width + xinc, (clr ? setBits : 0), setBits);
-
-        y0 += endBit - startBit + 1; // increment Y0 to next page
-
-        pageCheckBoundsRange(m_pageState[i], x0,
-                        x1); // mark dirty range in page desc
-    }
-}
-
-////////////////////////////////////////////////////////////////////////////////////////
-// draw_rect_fill()
-//
-// Does the actual drawing/logic
-
-void QwGrCH1120::drawRectFilled(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
-{
-    uint8_t x1 = x0 + width - 1;
-    uint8_t y1 = y0 + height - 1;
-
-    // just call vert line
-    drawLineVert(x0, y0, x1, y1, clr);
-}
-
-////////////////////////////////////////////////////////////////////////////////////
-// draw_bitmap()
-//
-// Draw a 8 bit encoded (aka same y layout as this device) bitmap to the screen
-//
-
-void QwGrCH1120::drawBitmap(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t dst_height, uint8_t *pBitmap,
-                             uint8_t bmp_width, uint8_t bmp_height)
-{
-    // some simple checks
-    if (x0 >= m_viewport.width || y0 >= m_viewport.height || !bmp_width || !bmp_height)
-        return;
-
-    // Bounds check
-    if (x0 + dst_width > m_viewport.width) // out of bounds
-        dst_width = m_viewport.width - x0;
-
-    if (bmp_width < dst_width)
-        dst_width = bmp_width;
-
-    if (y0 + dst_height > m_viewport.height) // out of bounds
-        dst_height = m_viewport.height - y0;
-
-    if (bmp_height < dst_height)
-        dst_height = bmp_height;
-
-    // current position in the bitmap
-    uint8_t bmp_x = 0;
-    uint8_t bmp_y = 0;
-
-    uint8_t page0, page1;
-    uint8_t startBit, endBit, grSetBits, grStartBit;
-
-    uint8_t bmp_mask[2], bmp_data, bmpPage;
-    uint8_t remainingBits, neededBits;
-
-    uint8_t y1 = y0 + dst_height - 1;
-
-    page0 = y0 / kByteNBits;
-    page1 = y1 / kByteNBits;
-
-    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
-
-    // The Plan:
-    //   - Walk down the graphics buffer range (y) one page at a time
-    //   - For each page
-    //          - Determine needed number of bits for the destination
-    //          - Determine what bits to pull from the bitmap
-    //              - Create a mask to pull out bits - from one or two bytes
-    //          - Loop over the x dimension
-    //              - pull bits from bitmap, build byte of data of bitmap bits, in
-    //                right order for the destination (graphics buffer)
-    //              - Write the bitmap bits to the graphis buffer using the
-    //              current operator
-
-    // Loop over the memory pages in the graphics buffer
-    for (int iPage = page0; iPage <= page1; iPage++)
-    {
-        // First, get the number of destination bits in the current page
-        grStartBit = mod_byte(y0); // start bit
-
-        // last bit of this byte to set? Does the copy region end in this byte, or
-        // continue on...
-        endBit = y0 + kByteNBits - grStartBit > y1 ? mod_byte(y1) : kByteNBits - 1;
-
-        // Set the bits from startBit to endBit
-        grSetBits = (0xFF >> (kByteNBits - endBit - 1)) << grStartBit; // what bits are being set in this byte
-
-        // how many bits of data do we need to transfer from the bitmap?
-        neededBits = endBit - grStartBit + 1;
-
-        // Okay, we have how much data to transfer to the current page. Now build
-        // the data from the bitmap.
-
-        // First, build bit masks for pulling the data out of the bmp array. The
-        // data might straddle two bytes, so build two masks
-
-        // as above, get the start and end bites for the current position in the
-        // bmp.
-        startBit = mod_byte(bmp_y);
-        endBit = (kByteNBits - startBit > neededBits ? startBit + neededBits : kByteNBits) - 1;
-
-        // Set the bits from startBit to endBit
-        bmp_mask[0] = (0xFF >> (kByteNBits - endBit - 1)) << startBit;
-
-        // any remaining bits to get?
-        remainingBits = neededBits - (endBit - startBit + 1); // +1 - needsBits is 1's based
-        bmp_mask[1] = 0xFF >> (kByteNBits - remainingBits);
-
-        // What row in the source bitmap
-        bmpPage = bmp_y / kByteNBits;
-
-        // we have the mask for the bmp - loop over the width of the copy region,
-        // pulling out bmp data and writing it to the graphics buffer
-        for (bmp_x = 0; bmp_x < dst_width; bmp_x++)
-        {
-            // get data bits out of current bitmap location and shift if needed
-            bmp_data = (pBitmap[bmp_width * bmpPage + bmp_x] & bmp_mask[0]) >> startBit;
-
-            if (remainingBits) // more data to add from the next byte in this column
-                bmp_data |= (pBitmap[bmp_width * (bmpPage + 1) + bmp_x] & bmp_mask[1]) << (neededBits - remainingBits);
-
-            // Write the bmp data to the graphics buffer - using current write op.
-            // Note, if the location in the buffer didn't start at bit 0, we shift
-            // bmp_data
-            curROP(m_pBuffer + iPage * m_viewport.width + bmp_x + x0, bmp_data << grStartBit, grSetBits);
-        }
-        // move up our y values (graphics buffer and bitmap) by the number of bits
-        // transferred
-        y0 += neededBits;
-        bmp_y += neededBits;
-        
-        pageCheckBoundsRange(m_pageState[iPage], x0,
-                        x0 + dst_width); // mark dirty range in page desc
-    }
-}
-
 ////////////////////////////////////////////////////////////////////////////////////
 // Device Update Methods
 ////////////////////////////////////////////////////////////////////////////////////
@@ -985,7 +602,7 @@ void QwGrCH1120::drawBitmap(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t d
 
 bool QwGrCH1120::setScreenBufferAddress(uint8_t row, uint8_t column)
 {
-    if (row >= m_viewport.height || column >= m_viewport.width)
+    if (row >= panelHeight() || column >= panelWidth())
         return false;
 
     // send the (row) address
@@ -1028,60 +645,21 @@ void QwGrCH1120::rawPrintBuffer() {
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
-// display()
+// transferRun()
 //
+// Send a run of "dirty" graphics buffer bytes to the device's screen buffer.
+// Called by display() for each run of dirty tiles in a page.
 
-// Send the "dirty" areas of the graphics buffer to the device's screen buffer.
-// Only send the areas that need to be updated. The update region is based on
-// new graphics to display, and any currently displayed items that need to be
-// erased.
-
-void QwGrCH1120::display()
-{   
-    // Loop over our page descriptors - if a page is dirty, send the graphics
-    // buffer dirty region to the device for the current page
-    pageState_t transferRange;
-
-    for (int i = 0 ; i < m_nPages; i++) {
-        // We keep the erase rect seperate from dirty rect. Make temp copy of
-        // dirty rect page range, expand to include erase rect page range.
-
-        transferRange = m_pageState[i];
-
-        // If an erase has happend, we need to transfer/include erase update range
-        if (m_pendingErase)
-            pageCheckBoundsDesc(transferRange, m_pageErase[i]);
-
-        if (pageIsClean(transferRange)) // both dirty and erase range for this
-                                        // page were null
-            continue;                   // next
-
-        // set the start address to write the updated data to the devices screen
-        // buffer
-
-        // write out the xmin and xmax for each page descriptor
-        // setScreenBufferAddress(i, transferRange.xmin + horz_flip_offset);
-        setScreenBufferAddress(transferRange.xmin + horz_flip_offset, i);
-
-        // send the dirty data to the device
-        sendDevData(m_pBuffer + (i * m_viewport.width) + transferRange.xmin, // this page start + xmin
-                    transferRange.xmax - transferRange.xmin + 1); // dirty region xmax - xmin. Add 1 b/c 0 based
-
-        // If we sent the erase bounds, zero out the erase bounds - this area is now
-        // clear
-        if (m_pendingErase)
-            pageSetClean(m_pageErase[i]);
-
-        // add the just send dirty range (non erase rec)  to the erase rect
-        pageCheckBoundsDesc(m_pageErase[i], m_pageState[i]);
+void QwGrCH1120::transferRun(uint8_t page, uint8_t x0, uint8_t *pData, uint8_t nData)
+{
+    // set the start address to write the updated data to the devices screen
+    // buffer
+    setScreenBufferAddress(x0 + horz_flip_offset, page);
 
-        // this page is no longer dirty - mark it  clean
-        pageSetClean(m_pageState[i]);
-    }
-    m_pendingErase = false; // no longer pending
+    // send the dirty data to the device
+    sendDevData(pData, nData);
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////////
 // Device communication methods
 ////////////////////////////////////////////////////////////////////////////////////
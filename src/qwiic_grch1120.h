@@ -37,7 +37,7 @@
 
 #pragma once
 
-#include "qwiic_grbuffer.h"
+#include "qwiic_grpage.h"
 #include "qwiic_i2c.h"
 #include "res/qwiic_resdef.h"
 #include "qwiic_grcommon.h"
@@ -48,7 +48,7 @@
 /////////////////////////////////////////////////////////////////////////////
 // Buffer Management
 /////////////////////////////////////////////////////////////////////////////
-class QwGrCH1120 : public QwGrBufferDevice {
+class QwGrCH1120 : public QwGrPageDevice {
     private: 
         void setupDefaults(void);
         
@@ -59,14 +59,10 @@ class QwGrCH1120 : public QwGrBufferDevice {
         QwGrCH1120(uint8_t width, uint8_t height) : QwGrCH1120(0, 0, width, height) {};
 
         // call super class
-        QwGrCH1120(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height) : QwGrBufferDevice(x0, y0, width, height) {
+        QwGrCH1120(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height) : QwGrPageDevice(x0, y0, width, height) {
             setupDefaults();
         };
 
-        // Public draw methods
-        void display(void); // send graphics buffer to the devices screen buffer
-        void erase(void);
-
         // Device setup
         virtual bool init(void);
 
@@ -88,14 +84,18 @@ class QwGrCH1120 : public QwGrBufferDevice {
         // default address of the device - expect the sub to fill in.
         uint8_t default_address;
 
-        void setRasterOp(grRasterOp_t rop) {
-            m_rop = rop;
-        }
-
         // screen control
         void invert(bool);
         void flipVert(bool);
         void flipHorz(bool);
+        bool setStartLine(uint8_t line);
+        bool setRotation(uint8_t rotation);
+
+        // no virtual canvas - the screen buffer has no rows beyond the screen
+        bool virtualCanvas(void)
+        {
+            return false;
+        }
 
         // screen scrolling
         void stopScroll(void);
@@ -104,28 +104,9 @@ class QwGrCH1120 : public QwGrBufferDevice {
         void displayPower(bool enable = true);
     
         protected: 
-            // Subclasses of this class define the specifics of the device, including size.
-            // Subclass needs to define the graphics buffer array - stack based - and pass in
-            void setBuffer(uint8_t *pBuffer);
-
-            ///////////////////////////////////////////////////////////////////////////
-            // Internal, fast draw routines - this are used in the overall
-            // draw interface (_QwIDraw) for this object/device/system.
-            //
-            // >> Pixels <<
-            void drawPixel(uint8_t x, uint8_t y, uint8_t clr);
-            
-            // >> Fast Lines <<
-            void drawLineHorz(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
-            void drawLineVert(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
-
-            // fast rect fill
-            void drawRectFilled(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr);
-
-            // >> Fast Bitmap <<
-            void drawBitmap(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
-                            uint8_t bmp_height);
-            
+            // send a run of graphics buffer bytes to the device - called by display()
+            void transferRun(uint8_t page, uint8_t x0, uint8_t *pData, uint8_t nData);
+
             //TODO: Are these needed for this driver?
             /////////////////////////////////////////////
             // configuration methods for sub-classes. Settings unique to a device
@@ -156,16 +137,8 @@ class QwGrCH1120 : public QwGrBufferDevice {
         /////////////////////////////////////////////////////////////////////////////
         // instance vars
 
-        // Buffer variables
-        uint8_t *m_pBuffer;                      // Pointer to the graphics buffer
-        uint8_t m_nPages;                        // number of pages for current device
-        pageState_t m_pageState[kMaxPageNumber]; // page state descriptors
-        pageState_t m_pageErase[kMaxPageNumber]; // keep track of erase boundaries
-        bool m_pendingErase;
-
         // display variables
         uint8_t m_color;    // current color (really 0 or 1)
-        grRasterOp_t m_rop; // current raster operation code
 
         // I2C  things
         QwI2C *m_i2cBus;      // pointer to our i2c bus object
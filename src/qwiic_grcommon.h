@@ -10,6 +10,8 @@
 //      - XOR       - XOR of color and current pixel value
 //      - Black     - Set value to always be black
 //      - White     - set value to always be white
+//      - OR        - OR of color and current pixel value
+//      - Mask      - Clear the pixels set in the color
 
 #pragma once
 
@@ -22,9 +24,19 @@ typedef enum gr_op_funcs_
     grROPNot = 2,
     grROPXOR = 3,
     grROPBlack = 4,
-    grROPWhite = 5
+    grROPWhite = 5,
+    grROPOr = 6,
+    grROPMask = 7
 } grRasterOp_t;
 
+// Horizontal alignment of the lines of a text box
+typedef enum gr_text_align_
+{
+    grTextAlignLeft = 0,
+    grTextAlignCenter = 1,
+    grTextAlignRight = 2
+} grTextAlign_t;
+
 typedef struct
 {
     int16_t xmin;
@@ -0,0 +1,555 @@
+
+// qwiic_grdisplaylist.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+////////////////////////////////////////////////////////////////////////////////////
+// Overview:
+//
+// Retained mode display list implementation.
+//
+// Records are kept in a fixed array - the index of a record is its ID, so IDs are stable
+// for the life of the record. A seperate order array defines the draw order.
+//
+// When a record changes, it's marked as changed. On render:
+//
+//      - The last drawn bounds and the new bounds of each changed record are added
+//        to a set of per-page invalid spans (xmin, xmax for each 8 pixel tall page)
+//      - For each invalid span
+//          - The device clip rect is set to the span and the span is cleared
+//          - Every record that overlaps the span is drawn, in list order
+//
+// Since the device only marks pixels inside the clip rect as dirty, the next display()
+// call only sends the re-rendered spans to the screen.
+
+#include "qwiic_grdisplaylist.h"
+
+// Record state flags
+#define kItemVisible 0x01
+#define kItemChanged 0x02
+#define kItemDrawn 0x04
+
+// Span helpers - an invalid span uses the pageState_t type
+#define spanIsClean(_span_) (_span_.xmin > _span_.xmax)
+
+#define spanSetClean(_span_)                                                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        _span_.xmin = 256;                                                                                             \
+        _span_.xmax = -1;                                                                                              \
+    } while (false)
+
+////////////////////////////////////////////////////////////////////////////////////
+// Constructor
+
+QwDisplayList::QwDisplayList() : m_nItems{0}, m_pending{false}, m_invalidAll{false}
+{
+    for (int i = 0; i < kDisplayListMaxItems; i++)
+        m_items[i].type = dlItemNone;
+
+    for (int i = 0; i < kDisplayListMaxPages; i++)
+        spanSetClean(m_invalid[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// item()
+//
+// Return the record for an ID, or nullptr if the ID isn't in use
+
+QwDisplayItem *QwDisplayList::item(uint8_t id)
+{
+    if (id >= kDisplayListMaxItems || m_items[id].type == dlItemNone)
+        return nullptr;
+
+    return &m_items[id];
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// newItem()
+//
+// Find a free record, fill it in and append it to the draw order.
+
+uint8_t QwDisplayList::newItem(uint8_t type, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
+{
+    if (m_nItems >= kDisplayListMaxItems)
+        return kDisplayListNoItem;
+
+    uint8_t id;
+    for (id = 0; id < kDisplayListMaxItems; id++)
+        if (m_items[id].type == dlItemNone)
+            break;
+
+    QwDisplayItem &theItem = m_items[id];
+
+    theItem.type = type;
+    theItem.flags = kItemVisible | kItemChanged;
+    theItem.clr = clr;
+    theItem.x0 = x0;
+    theItem.y0 = y0;
+    theItem.x1 = x1;
+    theItem.y1 = y1;
+    theItem.text = nullptr;
+    theItem.font = nullptr;
+
+    m_order[m_nItems++] = id;
+    m_pending = true;
+
+    return id;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Add methods
+
+uint8_t QwDisplayList::addLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
+{
+    return newItem(dlItemLine, x0, y0, x1, y1, clr);
+}
+
+uint8_t QwDisplayList::addRectangle(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
+{
+    return newItem(dlItemRect, x0, y0, width, height, clr);
+}
+
+uint8_t QwDisplayList::addRectangleFill(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
+{
+    return newItem(dlItemRectFill, x0, y0, width, height, clr);
+}
+
+uint8_t QwDisplayList::addCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr)
+{
+    return newItem(dlItemCircle, x0, y0, radius, 0, clr);
+}
+
+uint8_t QwDisplayList::addCircleFill(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr)
+{
+    return newItem(dlItemCircleFill, x0, y0, radius, 0, clr);
+}
+
+uint8_t QwDisplayList::addText(uint8_t x0, uint8_t y0, const char *text, uint8_t clr, QwFont *font)
+{
+    if (!text)
+        return kDisplayListNoItem;
+
+    uint8_t id = newItem(dlItemText, x0, y0, 0, 0, clr);
+
+    if (id != kDisplayListNoItem)
+    {
+        m_items[id].text = text;
+        m_items[id].font = font;
+    }
+    return id;
+}
+
+uint8_t QwDisplayList::addBitmap(uint8_t x0, uint8_t y0, QwBitmap &bitmap)
+{
+    uint8_t id = newItem(dlItemBitmap, x0, y0, 0, 0, 1);
+
+    if (id != kDisplayListNoItem)
+        m_items[id].bitmap = &bitmap;
+
+    return id;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// moveTo()
+//
+// Move a record so its origin is at (x0, y0). For lines, the origin is the
+// first end point and the line is translated.
+
+bool QwDisplayList::moveTo(uint8_t id, uint8_t x0, uint8_t y0)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem)
+        return false;
+
+    if (pItem->x0 == x0 && pItem->y0 == y0)
+        return true; // no change
+
+    if (pItem->type == dlItemLine)
+    {
+        pItem->x1 += x0 - pItem->x0;
+        pItem->y1 += y0 - pItem->y0;
+    }
+    pItem->x0 = x0;
+    pItem->y0 = y0;
+
+    invalidate(id);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setColor()
+
+bool QwDisplayList::setColor(uint8_t id, uint8_t clr)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem)
+        return false;
+
+    if (pItem->clr != clr)
+    {
+        pItem->clr = clr;
+        invalidate(id);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setText()
+//
+// Set the string of a text record. Always invalidates, since the contents
+// of the string could have changed.
+
+bool QwDisplayList::setText(uint8_t id, const char *text)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem || pItem->type != dlItemText || !text)
+        return false;
+
+    pItem->text = text;
+    invalidate(id);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setVisible()
+
+bool QwDisplayList::setVisible(uint8_t id, bool visible)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem)
+        return false;
+
+    if (((pItem->flags & kItemVisible) != 0) != visible)
+    {
+        pItem->flags ^= kItemVisible;
+        invalidate(id);
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// remove()
+//
+// Remove a record from the list. The area it covered is redrawn on the next render.
+
+bool QwDisplayList::remove(uint8_t id)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem)
+        return false;
+
+    if (pItem->flags & kItemDrawn)
+        invalidateRect(pItem->bx0, pItem->by0, pItem->bx1, pItem->by1);
+
+    pItem->type = dlItemNone;
+
+    // pull it from the draw order
+    uint8_t i, j;
+    for (i = 0, j = 0; i < m_nItems; i++)
+        if (m_order[i] != id)
+            m_order[j++] = m_order[i];
+    m_nItems = j;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// clear()
+
+void QwDisplayList::clear(void)
+{
+    while (m_nItems > 0)
+        remove(m_order[m_nItems - 1]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// invalidate()
+
+void QwDisplayList::invalidate(uint8_t id)
+{
+    QwDisplayItem *pItem = item(id);
+    if (!pItem)
+        return;
+
+    pItem->flags |= kItemChanged;
+    m_pending = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// invalidateAll()
+//
+// Redraw the entire device area on the next render - use after a device erase().
+
+void QwDisplayList::invalidateAll(void)
+{
+    for (uint8_t i = 0; i < m_nItems; i++)
+        m_items[m_order[i]].flags |= kItemChanged;
+
+    m_invalidAll = true;
+    m_pending = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// invalidateRect()
+//
+// Add a rect (inclusive bounds) to the invalid page spans
+
+void QwDisplayList::invalidateRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    uint8_t page1 = y1 / kByteNBits;
+
+    if (page1 >= kDisplayListMaxPages)
+        page1 = kDisplayListMaxPages - 1;
+
+    for (uint8_t i = y0 / kByteNBits; i <= page1; i++)
+    {
+        if (x0 < m_invalid[i].xmin)
+            m_invalid[i].xmin = x0;
+        if (x1 > m_invalid[i].xmax)
+            m_invalid[i].xmax = x1;
+    }
+    m_pending = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// itemBounds()
+//
+// Compute the bounds of a record, as drawn on the device. Returns false if nothing
+// would be drawn.
+
+bool QwDisplayList::itemBounds(QwGrBufferDevice &device, QwDisplayItem &theItem)
+{
+    int16_t x0 = theItem.x0, y0 = theItem.y0, x1, y1;
+
+    switch (theItem.type)
+    {
+    case dlItemLine:
+        x1 = theItem.x1;
+        y1 = theItem.y1;
+        if (x0 > x1)
+            swap_int(x0, x1);
+        if (y0 > y1)
+            swap_int(y0, y1);
+        break;
+
+    case dlItemRect:
+    case dlItemRectFill:
+        if (!theItem.x1 || !theItem.y1)
+            return false;
+        x1 = x0 + theItem.x1 - 1;
+        y1 = y0 + theItem.y1 - 1;
+        break;
+
+    case dlItemCircle:
+    case dlItemCircleFill:
+        if (!theItem.x1)
+            return false;
+        x1 = x0 + theItem.x1;
+        y1 = y0 + theItem.x1;
+        x0 -= theItem.x1;
+        y0 -= theItem.x1;
+        break;
+
+    case dlItemText: {
+        uint16_t width, height;
+
+        if (theItem.font)
+            device.setFont(theItem.font);
+
+        if (!device.getStringSize(theItem.text, width, height) || !width)
+            return false;
+
+        // text is rendered in full bytes - at least one page tall
+        x1 = x0 + width - 1;
+        y1 = y0 + (height < kByteNBits ? kByteNBits : height) - 1;
+        break;
+    }
+    case dlItemBitmap:
+        if (!theItem.bitmap || !theItem.bitmap->width || !theItem.bitmap->height)
+            return false;
+        x1 = x0 + theItem.bitmap->width - 1;
+        y1 = y0 + theItem.bitmap->height - 1;
+        break;
+
+    default:
+        return false;
+    }
+
+    // on the device?
+    if (x0 >= device.width() || y0 >= device.height() || x1 < 0 || y1 < 0)
+        return false;
+
+    theItem.bx0 = x0 < 0 ? 0 : x0;
+    theItem.by0 = y0 < 0 ? 0 : y0;
+    theItem.bx1 = x1 >= device.width() ? device.width() - 1 : x1;
+    theItem.by1 = y1 >= device.height() ? device.height() - 1 : y1;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// drawItem()
+
+void QwDisplayList::drawItem(QwGrBufferDevice &device, QwDisplayItem &theItem)
+{
+    switch (theItem.type)
+    {
+    case dlItemLine:
+        device.line(theItem.x0, theItem.y0, theItem.x1, theItem.y1, theItem.clr);
+        break;
+    case dlItemRect:
+        device.rectangle(theItem.x0, theItem.y0, theItem.x1, theItem.y1, theItem.clr);
+        break;
+    case dlItemRectFill:
+        device.rectangleFill(theItem.x0, theItem.y0, theItem.x1, theItem.y1, theItem.clr);
+        break;
+    case dlItemCircle:
+        device.circle(theItem.x0, theItem.y0, theItem.x1, theItem.clr);
+        break;
+    case dlItemCircleFill:
+        device.circleFill(theItem.x0, theItem.y0, theItem.x1, theItem.clr);
+        break;
+    case dlItemText:
+        device.text(theItem.x0, theItem.y0, theItem.text, theItem.clr);
+        break;
+    case dlItemBitmap:
+        device.bitmap(theItem.x0, theItem.y0, *theItem.bitmap);
+        break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// render()
+//
+// Bring the device buffer up to date with the list.
+
+void QwDisplayList::render(QwGrBufferDevice &device)
+{
+    if (!m_pending)
+        return;
+
+    uint8_t i, id;
+
+    // Stash the device state we change
+    QwRect clip = device.clipRect();
+    grRasterOp_t rop = device.rasterOp();
+    QwFont *pFont = device.font();
+
+    if (m_invalidAll)
+    {
+        invalidateRect(0, 0, device.width() - 1, device.height() - 1);
+        m_invalidAll = false;
+    }
+
+    // Pass 1 - fold changed records into the invalid spans. Both where the record
+    // was, and where it is now.
+    for (i = 0; i < m_nItems; i++)
+    {
+        QwDisplayItem &theItem = m_items[m_order[i]];
+
+        if (!(theItem.flags & kItemChanged))
+            continue;
+
+        if (theItem.flags & kItemDrawn)
+            invalidateRect(theItem.bx0, theItem.by0, theItem.bx1, theItem.by1);
+
+        theItem.flags &= ~(kItemChanged | kItemDrawn);
+
+        if ((theItem.flags & kItemVisible) && itemBounds(device, theItem))
+        {
+            theItem.flags |= kItemDrawn;
+            invalidateRect(theItem.bx0, theItem.by0, theItem.bx1, theItem.by1);
+        }
+        device.setFont(pFont);
+    }
+
+    // Pass 2 - re-rasterize each invalid span
+    uint8_t nPages = (device.height() + kByteNBits - 1) / kByteNBits;
+    if (nPages > kDisplayListMaxPages)
+        nPages = kDisplayListMaxPages;
+
+    uint8_t x0, y0, x1, y1;
+
+    for (uint8_t page = 0; page < nPages; page++)
+    {
+        if (spanIsClean(m_invalid[page]))
+            continue;
+
+        x0 = m_invalid[page].xmin;
+        x1 = m_invalid[page].xmax >= device.width() ? device.width() - 1 : m_invalid[page].xmax;
+        y0 = page * kByteNBits;
+        y1 = y0 + kByteNBits - 1 >= device.height() ? device.height() - 1 : y0 + kByteNBits - 1;
+
+        spanSetClean(m_invalid[page]);
+
+        if (x0 > x1)
+            continue;
+
+        device.setClipRect(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+        // clear the span
+        device.setRasterOp(grROPCopy);
+        device.rectangleFillSolid(x0, y0, x1 - x0 + 1, y1 - y0 + 1, 0);
+        device.setRasterOp(rop);
+
+        // draw everything that overlaps the span - in order
+        for (i = 0; i < m_nItems; i++)
+        {
+            id = m_order[i];
+            QwDisplayItem &theItem = m_items[id];
+
+            if (!(theItem.flags & kItemDrawn) || theItem.bx0 > x1 || theItem.bx1 < x0 || theItem.by0 > y1 ||
+                theItem.by1 < y0)
+                continue;
+
+            device.setFont(theItem.type == dlItemText && theItem.font ? theItem.font : pFont);
+            drawItem(device, theItem);
+        }
+    }
+    // put back the device state
+    device.setClipRect(clip.x, clip.y, clip.width, clip.height);
+    device.setFont(pFont);
+
+    m_pending = false;
+}
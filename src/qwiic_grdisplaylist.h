@@ -0,0 +1,174 @@
+
+// qwiic_grdisplaylist.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// A retained mode display list for the graphics system.
+//
+// The display list holds a set of primitive records (lines, rects, circles, text and
+// bitmaps), each with a stable ID. When a record changes, only the page spans that
+// the record covered - before and after the change - are re-rasterized. Every record
+// that overlaps an affected span is redrawn in list order, clipped to the span, so
+// overlapping items composite correctly.
+//
+// The rendered spans are marked dirty in the device, so the next display() call
+// transfers just the changed region to the screen.
+
+#pragma once
+
+#include "qwiic_grbuffer.h"
+
+// The number of records a list can hold - each record is ~16 bytes. Can be
+// overridden at build time.
+#ifndef kDisplayListMaxItems
+#define kDisplayListMaxItems 16
+#endif
+
+// The max number of pages (8 pixel rows) tracked for invalidation - 128 pixels
+#define kDisplayListMaxPages 16
+
+// ID returned when a record can't be added
+#define kDisplayListNoItem 0xFF
+
+// Record types
+typedef enum qw_dl_item_type_
+{
+    dlItemNone = 0,
+    dlItemLine,
+    dlItemRect,
+    dlItemRectFill,
+    dlItemCircle,
+    dlItemCircleFill,
+    dlItemText,
+    dlItemBitmap
+} dlItemType_t;
+
+// A display list record
+struct QwDisplayItem
+{
+    uint8_t type;  // dlItemType_t
+    uint8_t flags; // state flags - visible, changed, drawn
+    uint8_t clr;
+
+    // Geometry - meaning depends on type
+    //    line      - (x0, y0) -> (x1, y1)
+    //    rect      - x0, y0, width = x1, height = y1
+    //    circle    - center x0, y0, radius = x1
+    //    text      - x0, y0
+    //    bitmap    - x0, y0
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+
+    // Bounds of the record when it was last drawn - inclusive
+    uint8_t bx0;
+    uint8_t by0;
+    uint8_t bx1;
+    uint8_t by1;
+
+    union {
+        const char *text;
+        QwBitmap *bitmap;
+    };
+    QwFont *font; // for text - nullptr == use the device font
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// QwDisplayList
+//
+
+class QwDisplayList
+{
+  public:
+    QwDisplayList();
+
+    // Add records - returns the ID of the new record, or kDisplayListNoItem if the list is full.
+    // Records are drawn in the order they are added.
+    uint8_t addLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr = 1);
+    uint8_t addRectangle(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr = 1);
+    uint8_t addRectangleFill(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr = 1);
+    uint8_t addCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr = 1);
+    uint8_t addCircleFill(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr = 1);
+
+    // Note: the text isn't copied - the string must stay valid while in the list. If
+    // the contents of the string change, call setText() or invalidate().
+    uint8_t addText(uint8_t x0, uint8_t y0, const char *text, uint8_t clr = 1, QwFont *font = nullptr);
+    uint8_t addBitmap(uint8_t x0, uint8_t y0, QwBitmap &bitmap);
+
+    // Change records
+    bool moveTo(uint8_t id, uint8_t x0, uint8_t y0);
+    bool setColor(uint8_t id, uint8_t clr);
+    bool setText(uint8_t id, const char *text);
+    bool setVisible(uint8_t id, bool visible);
+    bool remove(uint8_t id);
+
+    // Remove all records - what they covered is cleared on the next render
+    void clear(void);
+
+    // Force a record, or the whole list, to be redrawn on the next render
+    void invalidate(uint8_t id);
+    void invalidateAll(void);
+
+    // Re-rasterize the changed regions of the list into the device buffer. The device
+    // clip rect and raster op are preserved.
+    void render(QwGrBufferDevice &device);
+
+  private:
+    QwDisplayItem *item(uint8_t id);
+    uint8_t newItem(uint8_t type, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
+
+    void invalidateRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+    bool itemBounds(QwGrBufferDevice &device, QwDisplayItem &theItem);
+    void drawItem(QwGrBufferDevice &device, QwDisplayItem &theItem);
+
+    QwDisplayItem m_items[kDisplayListMaxItems];
+
+    // draw order - ids
+    uint8_t m_order[kDisplayListMaxItems];
+    uint8_t m_nItems;
+
+    // Invalid spans for each page
+    pageState_t m_invalid[kDisplayListMaxPages];
+    bool m_pending;    // anything to do?
+    bool m_invalidAll; // redraw everything
+};
@@ -0,0 +1,214 @@
+
+// qwiic_grlayers.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Overview:
+//
+// Layer stack implementation.
+//
+// On compose, the dirty tiles of every layer are merged for each page. For each run of
+// dirty tiles:
+//
+//      - The top-most copy layer that covers the run is found. Layers below it can't
+//        change the result, so composition starts at that layer. If there isn't one,
+//        the run is cleared.
+//      - The remaining layers are copied into the run with copyRect(), using the layer
+//        raster op.
+//
+// The device marks the composed tiles as dirty, so the next display() only sends them.
+// Once composed, the layers are marked clean - display() on a canvas just updates its
+// tile maps.
+
+#include "qwiic_grlayers.h"
+
+////////////////////////////////////////////////////////////////////////////////////
+// Constructor
+
+QwLayerStack::QwLayerStack() : m_nLayers{0}, m_invalid{true}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// addLayer()
+//
+// Add a layer to the top of the stack. The full screen is composed on the next
+// compose call.
+
+bool QwLayerStack::addLayer(QwCanvas &layer, grRasterOp_t rop)
+{
+    if (m_nLayers >= kLayerStackMaxLayers)
+        return false;
+
+    m_layers[m_nLayers] = &layer;
+    m_ops[m_nLayers] = rop;
+    m_nLayers++;
+
+    m_invalid = true;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setLayerOp()
+
+bool QwLayerStack::setLayerOp(uint8_t index, grRasterOp_t rop)
+{
+    if (index >= m_nLayers)
+        return false;
+
+    if (m_ops[index] != rop)
+    {
+        m_ops[index] = rop;
+        m_invalid = true;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// clear()
+
+void QwLayerStack::clear(void)
+{
+    m_nLayers = 0;
+    m_invalid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// invalidate()
+
+void QwLayerStack::invalidate(void)
+{
+    m_invalid = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// compose()
+//
+// Rebuild the tiles of the device graphics buffer that are dirty in any layer.
+
+void QwLayerStack::compose(QwGrPageDevice &device)
+{
+    if (!m_nLayers)
+        return;
+
+    uint8_t width = device.width();
+    uint8_t height = device.height();
+    uint8_t nPages = (height + kByteNBits - 1) / kByteNBits;
+    uint8_t nTiles = (width + kTileWidth - 1) / kTileWidth;
+
+    // The layers are combined over the full screen - save the current device settings
+    QwRect clip = device.clipRect();
+    grRasterOp_t rop = device.rasterOp();
+
+    device.clearClipRect();
+
+    uint32_t bits;
+    uint8_t tile, tile0, tile1;
+    uint8_t x0, x1, y0, y1, iLayer;
+    int8_t i;
+
+    for (uint8_t page = 0; page < nPages; page++)
+    {
+        // the tiles to compose in this page
+        if (m_invalid)
+            bits = 0xFFFFFFFF >> (32 - nTiles);
+        else
+        {
+            bits = 0;
+            for (i = 0; i < m_nLayers; i++)
+                bits |= m_layers[i]->dirtyTiles(page);
+        }
+
+        y0 = page * kByteNBits;
+        y1 = y0 + kByteNBits - 1 >= height ? height - 1 : y0 + kByteNBits - 1;
+
+        // Walk the runs of tiles
+        for (tile = 0; bits; tile++, bits >>= 1)
+        {
+            if (!(bits & 1))
+                continue;
+
+            tile0 = tile;
+            while (bits & 2)
+            {
+                bits >>= 1;
+                tile++;
+            }
+            tile1 = tile;
+
+            if (tile0 >= nTiles)
+                break;
+
+            x0 = tile0 * kTileWidth;
+            x1 = tile1 >= nTiles - 1 ? width - 1 : tile1 * kTileWidth + kTileWidth - 1;
+
+            // Find the top copy layer that covers the run - nothing below it shows
+            for (i = m_nLayers - 1; i >= 0; i--)
+            {
+                if (m_ops[i] == grROPCopy && m_layers[i]->width() > x1 && m_layers[i]->height() > y1)
+                    break;
+            }
+            if (i < 0)
+            {
+                device.setRasterOp(grROPCopy);
+                device.rectangleFillSolid(x0, y0, x1 - x0 + 1, y1 - y0 + 1, 0);
+                i = 0;
+            }
+            for (iLayer = i; iLayer < m_nLayers; iLayer++)
+            {
+                device.setRasterOp(m_ops[iLayer]);
+                device.copyRect(*m_layers[iLayer], x0, y0, x1 - x0 + 1, y1 - y0 + 1, x0, y0);
+            }
+        }
+    }
+
+    // The layers are now composed - mark them clean
+    for (i = 0; i < m_nLayers; i++)
+        m_layers[i]->display();
+
+    // put back the device state
+    device.setClipRect(clip.x, clip.y, clip.width, clip.height);
+    device.setRasterOp(rop);
+
+    m_invalid = false;
+}
@@ -0,0 +1,109 @@
+
+// qwiic_grlayers.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//
+// Layer stack - a multi-layer compositor.
+//
+// A layer stack combines up to kLayerStackMaxLayers canvases (QwCanvas) into the graphics
+// buffer of a display. Each layer is placed at the upper left corner of the display, and
+// is combined with the layers below it using its raster op - for example:
+//
+//      - grROPCopy - an opaque layer, such as a static background
+//      - grROPOr   - pixels set in the layer are added
+//      - grROPXOR  - pixels set in the layer are inverted, such as a cursor
+//      - grROPMask - pixels set in the layer are cleared
+//
+// Each layer tracks its own dirty tiles. When composed, only the tiles that are dirty in
+// at least one layer are rebuilt, so a blinking cursor on an overlay layer doesn't cause
+// the content under it to be redrawn.
+
+#pragma once
+
+#include "qwiic_grcanvas.h"
+
+// The number of layers in a stack. Can be overridden at build time.
+#ifndef kLayerStackMaxLayers
+#define kLayerStackMaxLayers 4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// QwLayerStack
+//
+
+class QwLayerStack
+{
+  public:
+    QwLayerStack();
+
+    // Add a layer to the top of the stack - returns false if the stack is full.
+    //
+    // Note: layers aren't copied - they must stay valid while in the stack.
+    bool addLayer(QwCanvas &layer, grRasterOp_t rop = grROPCopy);
+
+    // Change the raster op of a layer - index 0 is the bottom layer
+    bool setLayerOp(uint8_t index, grRasterOp_t rop);
+
+    // Remove all layers
+    void clear(void);
+
+    uint8_t count(void)
+    {
+        return m_nLayers;
+    }
+
+    // The device graphics changed outside of the stack (erase, drawing) - rebuild
+    // the full screen on the next compose
+    void invalidate(void);
+
+    // Rebuild the dirty tiles of the layers in the device graphics buffer. Call before
+    // display(). The device clip rect and raster op are preserved.
+    void compose(QwGrPageDevice &device);
+
+  private:
+    QwCanvas *m_layers[kLayerStackMaxLayers];
+    grRasterOp_t m_ops[kLayerStackMaxLayers];
+    uint8_t m_nLayers;
+
+    bool m_invalid; // compose all tiles
+};
@@ -0,0 +1,165 @@
+
+// qwiic_grnumfield.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "qwiic_grnumfield.h"
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////////
+
+QwNumberField::QwNumberField()
+    : m_pFont{nullptr}, m_x0{0}, m_y0{0}, m_nChars{0}, m_pitch{0}, m_zeroPad{false}, m_color{1}, m_value{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// begin()
+
+bool QwNumberField::begin(QwFont &theFont, uint8_t x0, uint8_t y0, uint8_t nChars, bool zeroPad, uint8_t clr)
+{
+    if (!nChars || nChars > kNumberFieldMaxChars)
+        return false;
+
+    m_pFont = &theFont;
+    m_x0 = x0;
+    m_y0 = y0;
+    m_nChars = nChars;
+    m_zeroPad = zeroPad;
+    m_color = clr;
+
+    QwGlyph theGlyph;
+    theFont.glyph('0', theGlyph);
+    m_pitch = theGlyph.advance ? theGlyph.advance : theFont.width;
+
+    invalidate();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+void QwNumberField::setValue(int32_t value)
+{
+    m_value = value;
+}
+
+void QwNumberField::invalidate(void)
+{
+    memset(m_shown, 0, sizeof(m_shown));
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// format()
+//
+// Format the value into the field - m_nChars characters, right aligned.
+
+void QwNumberField::format(char *pText)
+{
+    bool negative = m_value < 0;
+    uint32_t value = negative ? 0 - (uint32_t)m_value : m_value;
+    uint8_t i = m_nChars;
+
+    // digits, from the right - always at least one
+    do
+    {
+        if (!i)
+            break;
+        pText[--i] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    // zero padding goes between the sign and the digits
+    if (m_zeroPad)
+        while (i > (negative ? 1 : 0))
+            pText[--i] = '0';
+
+    if (negative && i)
+        pText[--i] = '-';
+    else if (negative)
+        value = 1; // no room for the sign
+
+    if (value) // doesn't fit
+    {
+        memset(pText, '-', m_nChars);
+        return;
+    }
+    while (i)
+        pText[--i] = ' ';
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// update()
+
+void QwNumberField::update(QwGrPageDevice &device)
+{
+    if (!m_pFont)
+        return;
+
+    char text[kNumberFieldMaxChars];
+    format(text);
+
+    grRasterOp_t rop = device.rasterOp();
+    QwFont *pFont = device.font();
+
+    device.setRasterOp(grROPCopy);
+    device.setFont(m_pFont);
+
+    uint16_t x;
+    for (uint8_t i = 0; i < m_nChars; i++)
+    {
+        if (text[i] == m_shown[i])
+            continue;
+
+        x = m_x0 + i * m_pitch;
+        if (x >= device.width())
+            break;
+
+        // clear the cell, then draw the new character
+        device.rectangleFillSolid(x, m_y0, m_pitch, m_pFont->height, !m_color);
+        device.text(x, m_y0, text + i, 1, m_color);
+
+        m_shown[i] = text[i];
+    }
+    device.setRasterOp(rop);
+    device.setFont(pFont);
+}
@@ -0,0 +1,118 @@
+
+// qwiic_grnumfield.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//
+// Number field - a numeric readout that only redraws the digits that change.
+//
+// A number field is a fixed width row of character cells at a position, right aligned,
+// drawn with a font. The field keeps the characters it last drew. On update, the new value
+// is formatted and compared with them - only the cells that differ are cleared and redrawn,
+// so only their tiles are sent on the next display(). A seconds counter touches one digit
+// per second.
+//
+// Cells are a fixed pitch - the advance of the digit '0' in the font - so digits stay in
+// place as the value changes. Negative values get a leading '-', and the value is padded
+// with spaces, or zeros after the sign. A value that doesn't fit the field is shown as
+// dashes.
+
+#pragma once
+
+#include "qwiic_grpage.h"
+
+// The number of characters a field can hold - a 32 bit value with its sign fits.
+#ifndef kNumberFieldMaxChars
+#define kNumberFieldMaxChars 11
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// QwNumberField
+//
+
+class QwNumberField
+{
+  public:
+    QwNumberField();
+
+    // Set the font and placement of the field - nChars cells wide, with the upper left
+    // corner at x0, y0. Returns false if nChars is 0 or larger than kNumberFieldMaxChars.
+    //
+    // The full field is drawn on the next update.
+    bool begin(QwFont &theFont, uint8_t x0, uint8_t y0, uint8_t nChars, bool zeroPad = false, uint8_t clr = 1);
+
+    void setValue(int32_t value);
+    int32_t value(void)
+    {
+        return m_value;
+    }
+
+    // Width of the field in pixels - can be wider than a screen, 11 large font characters
+    uint16_t width(void)
+    {
+        return m_nChars * m_pitch;
+    }
+
+    // Draw every cell on the next update - for example after the screen is erased
+    void invalidate(void);
+
+    // Redraw the cells that changed since the last update. The device clip rect and
+    // raster op are preserved.
+    void update(QwGrPageDevice &device);
+
+  private:
+    void format(char *pText);
+
+    QwFont *m_pFont;
+
+    uint8_t m_x0;
+    uint8_t m_y0;
+    uint8_t m_nChars;
+    uint8_t m_pitch; // cell width
+    bool m_zeroPad;
+    uint8_t m_color;
+
+    int32_t m_value;
+
+    // The characters on screen - a 0 entry is redrawn on the next update
+    char m_shown[kNumberFieldMaxChars];
+};
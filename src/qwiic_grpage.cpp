@@ -0,0 +1,1763 @@
+
+// qwiic_grpage.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "qwiic_grpage.h"
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// Class that implements the drawing kernels for page organized graphics
+// buffers. See the header for a description of the buffer and tile maps.
+//
+//////////////////////////////////////////////////////////////////////////////////
+// Tile Maps
+//
+// A key feature of this library is that it only sends "dirty" pixels to the
+// device, minimizing data transfer over the I2C bus. To accomplish this, the
+// dirty 8x8 tiles of the graphics buffer are recorded during drawing operations.
+// When data is sent to the device, only the tiles in these regions are sent to
+// the device, not the entire page of data.
+//
+// The below macros are used to manage the tile bits. Given that these actions
+// are taking place in the draw loop, macros are used for performance considerations.
+
+// pointer to the tile bytes of a page
+#define tilePageRow(_map_, _page_) ((_map_) + (_page_)*m_tileStride)
+
+// Offset (in rows) used to keep block transfer source row math positive - larger
+// than any buffer height
+#define kMaxPageOffset 256
+
+// mark the tile that contains column _x_ of a page
+#define tileSetDirty(_page_, _x_)                                                                                      \
+    (tilePageRow(m_tileDirty, _page_)[(_x_) / kTileWidth / kByteNBits] |= byte_bits[mod_byte((_x_) / kTileWidth)])
+
+////////////////////////////////////////////////////////////////////////////////////
+// Pixel write/set operations
+//
+// Using LAMBDAs to create fast raster write/set operations. Using this pattern
+// eleminates the need for switch/if statements in each draw routine. This is
+// basically classic ROPs'
+//
+// NOTE - the order in the arrays is based on grRasterOp_t enum
+//
+// The Graphic operator functions (ROPS)
+//      - Copy      - copy the pixel value in to the buffer (default)
+//      - Not Copy  - copy the not of the pixel value to buffer
+//      - Not       - Set the buffer value to not it's current value
+//      - XOR       - XOR of color and current pixel value
+//      - Black     - Set value to always be black
+//      - White     - set value to always be white
+//      - OR        - OR of color and current pixel value
+//      - Mask      - Clear the pixels set in the color
+
+// Pattern for solid spans - every pixel set
+static const uint8_t solidPattern[kFillPatternSize] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+static const rasterOPsFn m_rasterOps[] = {
+    // COPY
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | (src & mask); },
+    // NOT COPY
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((~src) & mask); },
+    // NOT DEST
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((~(*dst)) & mask); },
+    // XOR
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = (~mask & *dst) | ((*dst ^ src) & mask); },
+    // Always Black
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = ~mask & *dst; },
+    // Always White
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = mask | *dst; },
+    // OR
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = *dst | (src & mask); },
+    // Mask - clear where set
+    [](uint8_t *dst, uint8_t src, uint8_t mask) -> void { *dst = *dst & ~(src & mask); }};
+
+// The raster op function of the current raster op - for the template kernels in the header
+rasterOPsFn QwGrPageDevice::rasterOpFn(void)
+{
+    return m_rasterOps[m_rop];
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// nextTileRun()
+//
+// Find the next run of set tiles in the tile row of a page. The search starts
+// at tile, and bits holds the tile row shifted to that tile. On return, tile0
+// and tile1 are the inclusive tile bounds of the run.
+//
+// If bMerge is set, clean gaps of up to kTileMergeGap tiles are merged into the run.
+//
+// Returns false when no set tiles remain.
+
+static bool nextTileRun(uint32_t &bits, uint8_t &tile, uint8_t &tile0, uint8_t &tile1, bool bMerge)
+{
+    if (!bits)
+        return false;
+
+    // skip the clean tiles - by byte, then by bit
+    while (!(bits & 0xFF))
+    {
+        bits >>= kByteNBits;
+        tile += kByteNBits;
+    }
+    while (!(bits & 1))
+    {
+        bits >>= 1;
+        tile++;
+    }
+    tile0 = tile;
+
+    // walk the run - if merging, continue over short gaps
+    while (true)
+    {
+        while (bits & 1)
+        {
+            bits >>= 1;
+            tile++;
+        }
+        if (!bMerge || !(bits & (((uint32_t)1 << (kTileMergeGap + 1)) - 1)))
+            break;
+
+        while (!(bits & 1))
+        {
+            bits >>= 1;
+            tile++;
+        }
+    }
+    tile1 = tile - 1;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setBuffer()
+//
+// Protected method - used by sub-class to set the graphics buffer array.
+//
+// The subclass knows the size of the specific device, so it statically defines
+// the graphics buffer array. The buffer is often set in the subclasses
+// on_initialize() method.
+//
+//
+void QwGrPageDevice::setBuffer(uint8_t *pBuffer)
+{
+    if (pBuffer)
+        m_pBuffer = pBuffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setPageCount()
+//
+// Set the number of pages in the graphics buffer and size the tile maps for the
+// current viewport.
+//
+// Returns false if the tile maps are too small for the buffer.
+
+bool QwGrPageDevice::setPageCount(uint8_t nPages)
+{
+    // tiles per page, then bytes to hold those tile bits
+    uint8_t nTiles = (m_viewport.width + kTileWidth - 1) / kTileWidth;
+
+    m_tileStride = (nTiles + kByteNBits - 1) / kByteNBits;
+
+    if (nPages * m_tileStride > kTileMapMaxBytes)
+        return false;
+
+    m_nPages = nPages;
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// clearBuffers()
+//
+// Will clear the local graphics buffer and set the tile maps to a "clean" state.
+
+void QwGrPageDevice::clearBuffers(void)
+{
+    // clear out the local graphics buffer
+    if (m_pBuffer)
+        memset(m_pBuffer, 0, m_viewport.width * m_nPages);
+
+    // Set tile maps to "clean" state
+    memset(m_tileDirty, 0, sizeof(m_tileDirty));
+    memset(m_tileErase, 0, sizeof(m_tileErase));
+
+    m_pendingErase = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// markDrawnDirty()
+//
+// Mark the tiles that contain graphics sent to the device as dirty - the next
+// call to display() will re-send these tiles.
+
+void QwGrPageDevice::markDrawnDirty(void)
+{
+    for (uint8_t i = 0; i < m_nPages * m_tileStride; i++)
+        m_tileDirty[i] |= m_tileErase[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// markDirty()
+//
+// Mark the tiles covering columns x0 to x1 (inclusive) of a page as dirty
+
+void QwGrPageDevice::markDirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+    uint8_t tile0 = x0 / kTileWidth;
+    uint8_t tile1 = x1 / kTileWidth;
+
+    uint8_t *pRow = tilePageRow(m_tileDirty, page);
+
+    // mask of the tile bits in the first and last bytes of the range
+    uint8_t mask0 = 0xFF << mod_byte(tile0);
+    uint8_t mask1 = 0xFF >> (kByteNBits - 1 - mod_byte(tile1));
+
+    tile0 /= kByteNBits;
+    tile1 /= kByteNBits;
+
+    if (tile0 == tile1)
+    {
+        pRow[tile0] |= mask0 & mask1;
+        return;
+    }
+    pRow[tile0] |= mask0;
+
+    for (uint8_t i = tile0 + 1; i < tile1; i++)
+        pRow[i] = 0xFF;
+
+    pRow[tile1] |= mask1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// textScaled()
+//
+// Draw text with the current font scaled up - each pixel of the font becomes a
+// scale x scale block, so the 5x7 and 8x16 fonts give large text without a large
+// font in flash. The text is scale times the size getStringSize() returns.
+
+void QwGrPageDevice::textScaled(uint8_t x0, uint8_t y0, const char *text, uint8_t scale, uint8_t clr)
+{
+    if (!m_currentFont)
+        initFont();
+
+    if (!m_pBuffer || !text || !scale || x0 >= m_viewport.width || y0 >= m_viewport.height)
+        return;
+
+    drawTextScaled(x0, y0, text, kTextToEnd, scale > kTextScaleMax ? kTextScaleMax : scale, clr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// writeRun()
+//
+// Write a run of bytes to a page and transfer it to the device right away - for
+// callers that rasterize their own data, like a text grid. The graphics buffer is
+// optional here: if present, the run is copied into it, so the buffer still matches
+// the device. The tiles of the run are added to the erase map, so a later erase()
+// clears them.
+//
+// A transposed (90 or 270 degree rotated) buffer doesn't match the device pages - the
+// run is copied into the buffer and its tiles marked dirty, and it's sent, turned, by
+// the next display().
+
+void QwGrPageDevice::writeRun(uint8_t page, uint8_t x0, const uint8_t *pData, uint8_t nData)
+{
+    if (!pData || !nData || page >= m_nPages || x0 >= m_viewport.width)
+        return;
+
+    if (nData > m_viewport.width - x0)
+        nData = m_viewport.width - x0;
+
+    uint8_t *pRun = (uint8_t *)pData; // the transfer only reads the data
+
+    if (m_transposed)
+    {
+        if (!m_pBuffer)
+            return;
+
+        memcpy(m_pBuffer + page * m_viewport.width + x0, pData, nData);
+        markDirty(page, x0, x0 + nData - 1);
+        return;
+    }
+    if (m_pBuffer)
+    {
+        pRun = m_pBuffer + page * m_viewport.width + x0;
+        memcpy(pRun, pData, nData);
+    }
+    transferRun(page, x0, pRun, nData);
+
+    uint8_t *pRow = tilePageRow(m_tileErase, page);
+    for (uint8_t tile = x0 / kTileWidth; tile <= (x0 + nData - 1) / kTileWidth; tile++)
+        pRow[tile / kByteNBits] |= byte_bits[mod_byte(tile)];
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setMarquee()
+//
+// Start a marquee - the text, in the current font, is fed in at the right edge of a
+// band of pages one column per marqueeStep(), and moves left across the band. After
+// the end of the text, the band runs blank for a screen width, then the text repeats.
+//
+// The band is the pages the font covers, from page0. It's cleared, in the graphics
+// buffer and on the device - drawing in the band while the marquee runs is lost.
+//
+// Returns false if the band doesn't fit the buffer, or the buffer is transposed - the
+// columns of the band aren't device columns.
+
+bool QwGrPageDevice::setMarquee(const char *text, uint8_t page0)
+{
+    m_marqueeText = nullptr;
+
+    if (!text) // stop
+        return true;
+
+    if (!m_currentFont)
+        initFont();
+
+    uint16_t width, height;
+    if (!m_pBuffer || m_transposed || !getStringSize(text, width, height) || !width)
+        return false;
+
+    uint8_t nRows = (m_currentFont->height + kByteNBits - 1) / kByteNBits;
+    if (page0 + nRows > m_nPages)
+        return false;
+
+    m_marqueeFont = m_currentFont;
+    m_marqueePage0 = page0;
+    m_marqueePage1 = page0 + nRows - 1;
+    m_marqueeColumn = 0;
+    m_marqueeLength = width + m_viewport.width;
+
+    // the device scrolls what it has - start both from a blank band
+    uint8_t *pRow;
+    for (uint8_t page = m_marqueePage0; page <= m_marqueePage1; page++)
+    {
+        pRow = m_pBuffer + page * m_viewport.width;
+        memset(pRow, 0, m_viewport.width);
+        transferRun(page, 0, pRow, m_viewport.width);
+    }
+    markMarqueeSent();
+
+    m_marqueeText = text;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// marqueeStep()
+//
+// Move the marquee one column left. The device scrolls the band of its screen buffer
+// with scrollColumnLeft(), the graphics buffer is shifted to match, and only the new
+// column - a byte per page of the band - is sent. If the device can't scroll, the
+// whole band is sent.
+//
+// The new column is drawn with drawText(), clipped to the last column of the band.
+
+bool QwGrPageDevice::marqueeStep(void)
+{
+    if (!m_marqueeText || m_transposed)
+        return false;
+
+    uint8_t x1 = m_viewport.width - 1;
+    uint8_t page, *pRow;
+
+    bool bScrolled = scrollColumnLeft(m_marqueePage0, m_marqueePage1);
+
+    for (page = m_marqueePage0; page <= m_marqueePage1; page++)
+    {
+        pRow = m_pBuffer + page * m_viewport.width;
+        memmove(pRow, pRow + 1, x1);
+        pRow[x1] = 0;
+    }
+
+    // the text column coming into view - blank once past the end of the text
+    if (m_marqueeColumn < m_marqueeLength - m_viewport.width)
+    {
+        QwFont *pFont = m_currentFont;
+        grRasterOp_t rop = m_rop;
+        uint8_t clipX0 = m_clipX0, clipY0 = m_clipY0, clipX1 = m_clipX1, clipY1 = m_clipY1;
+
+        m_currentFont = m_marqueeFont;
+        m_rop = grROPCopy;
+        m_clipX0 = m_clipX1 = x1;
+        m_clipY0 = m_marqueePage0 * kByteNBits;
+        m_clipY1 = m_marqueePage1 * kByteNBits + kByteNBits - 1;
+
+        drawText((int16_t)x1 - m_marqueeColumn, m_clipY0, m_marqueeText, kTextToEnd, 1);
+
+        m_currentFont = pFont;
+        m_rop = rop;
+        m_clipX0 = clipX0;
+        m_clipY0 = clipY0;
+        m_clipX1 = clipX1;
+        m_clipY1 = clipY1;
+    }
+    if (++m_marqueeColumn == m_marqueeLength)
+        m_marqueeColumn = 0;
+
+    for (page = m_marqueePage0; page <= m_marqueePage1; page++)
+    {
+        pRow = m_pBuffer + page * m_viewport.width;
+        if (bScrolled)
+            transferRun(page, x1, pRow + x1, 1);
+        else
+            transferRun(page, 0, pRow, m_viewport.width);
+    }
+    markMarqueeSent();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// markMarqueeSent()
+//
+// The marquee band matches the device - its tiles aren't dirty, and are all in the
+// erase map, so erase() clears the band.
+
+void QwGrPageDevice::markMarqueeSent(void)
+{
+    uint8_t nTiles = (m_viewport.width + kTileWidth - 1) / kTileWidth;
+    uint8_t *pErase;
+
+    for (uint8_t page = m_marqueePage0; page <= m_marqueePage1; page++)
+    {
+        memset(tilePageRow(m_tileDirty, page), 0, m_tileStride);
+
+        pErase = tilePageRow(m_tileErase, page);
+        for (uint8_t tile = 0; tile < nTiles; tile++)
+            pErase[tile / kByteNBits] |= byte_bits[mod_byte(tile)];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// tileRow()
+//
+// Return the tile bits of a page as a single value - tile 0 is bit 0. A page is
+// at most 255 pixels wide, so it fits into 32 bits.
+
+uint32_t QwGrPageDevice::tileRow(const uint8_t *pMap, uint8_t page)
+{
+    const uint8_t *pRow = tilePageRow(pMap, page);
+    uint32_t row = 0;
+
+    for (uint8_t i = 0; i < m_tileStride; i++)
+        row |= (uint32_t)pRow[i] << (i * kByteNBits);
+
+    return row;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// dirtyTiles()
+//
+// Return the tiles of a page that will be sent by the next display() call - the
+// dirty tiles, plus the erase tiles if an erase is pending.
+
+uint32_t QwGrPageDevice::dirtyTiles(uint8_t page)
+{
+    if (page >= m_nPages)
+        return 0;
+
+    uint32_t bits = tileRow(m_tileDirty, page);
+
+    if (m_pendingErase)
+        bits |= tileRow(m_tileErase, page);
+
+    return bits;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Drawing Methods
+////////////////////////////////////////////////////////////////////////////////////
+// erase()
+//
+// Erase the graphics that are on screen and anything that's been draw but
+// haven't been sent to the screen.
+//
+
+void QwGrPageDevice::erase(void)
+{
+    if (!m_pBuffer)
+        return;
+
+    uint32_t bits;
+    uint8_t tile, tile0, tile1;
+    uint16_t x0, x1;
+
+    // Cleanup the dirty tiles of each page in the graphics buffer.
+    for (uint8_t i = 0; i < m_nPages; i++)
+    {
+        // The current "dirty" tiles of the graphics [local] buffer - tiles that
+        // haven't been sent to the screen/device, plus the tiles with pixels set
+        // that have been sent to the device - the erase map.
+        bits = tileRow(m_tileDirty, i) | tileRow(m_tileErase, i);
+
+        // clear out memory that is dirty on this page
+        tile = 0;
+        while (nextTileRun(bits, tile, tile0, tile1, false))
+        {
+            x0 = tile0 * kTileWidth;
+            x1 = tile1 * kTileWidth + kTileWidth - 1;
+            if (x1 >= m_viewport.width) // last tile can be partial
+                x1 = m_viewport.width - 1;
+
+            memset(m_pBuffer + i * m_viewport.width + x0, 0, x1 - x0 + 1);
+        }
+
+        // clear out any pending dirty tiles for this page - it's erased
+        memset(tilePageRow(m_tileDirty, i), 0, m_tileStride);
+    }
+
+    // Indicate that the data transfer to the device should include the erase
+    // region
+    m_pendingErase = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+//
+// draw_pixel()
+//
+// Used to set a pixel in the graphics buffer - uses the current write operator
+// function
+//
+
+void QwGrPageDevice::drawPixel(uint8_t x, uint8_t y, uint8_t clr)
+{
+    // quick sanity check on range - the clip rect is always inside the viewport
+    if (x < m_clipX0 || x > m_clipX1 || y < m_clipY0 || y > m_clipY1)
+        return; // out of bounds
+
+    uint8_t bit = byte_bits[mod_byte(y)];
+
+    m_rasterOps[m_rop](m_pBuffer + x + y / kByteNBits * m_viewport.width, // pixel offset
+                       (clr ? bit : 0), bit);                             // which bit to set in byte
+
+    tileSetDirty(y / kByteNBits, x); // update dirty tile for page
+}
+////////////////////////////////////////////////////////////////////////////////////
+// draw_line_horz()
+//
+// Fast horizontal line drawing routine
+//
+
+void QwGrPageDevice::drawLineHorz(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
+{
+    // Basically we set a bit within a range in a page of our graphics buffer.
+
+    // in range
+    if (y0 < m_clipY0 || y0 > m_clipY1)
+        return;
+
+    if (x0 > x1)
+        swap_int(x0, x1);
+
+    // clip to the current clip rect
+    if (x0 < m_clipX0)
+        x0 = m_clipX0;
+
+    if (x1 > m_clipX1)
+        x1 = m_clipX1;
+
+    if (x0 > x1) // nothing left to draw
+        return;
+
+    uint8_t bit = byte_bits[mod_byte(y0)];   // bit to set
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    // Get the start of this line in the graphics buffer
+    uint8_t *pBuffer = m_pBuffer + x0 + y0 / kByteNBits * m_viewport.width;
+
+    // walk up x and set the target pixel using the pixel operator function
+    for (int i = x0; i <= x1; i++, pBuffer++)
+        curROP(pBuffer, (clr ? bit : 0), bit);
+
+    // Mark the page tiles dirty for the range drawn
+    markDirty(y0 / kByteNBits, x0, x1);
+}
+////////////////////////////////////////////////////////////////////////////////////
+// draw_line_vert()
+//
+// Fast vertical line drawing routine - also supports fast filled rects
+//
+void QwGrPageDevice::drawLineVert(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr)
+{
+    // want an accending order
+    if (y0 > y1)
+        swap_int(y0, y1);
+
+    // keep inside the clip rect
+    if (y0 < m_clipY0)
+        y0 = m_clipY0;
+
+    if (y1 > m_clipY1)
+        y1 = m_clipY1;
+
+    if (y0 > y1) // out of bounds
+        return;
+
+    uint8_t startBit, endBit, setBits;
+
+    // Get the start and end pages we are writing to
+    uint8_t page0 = y0 / kByteNBits;
+    uint8_t page1 = y1 / kByteNBits;
+
+    // loop over the pages. For each page determine the range of pixels
+    // to set in the target page byte and then set them using the current
+    // pixel operator function
+
+    // Note: This function can also be used to draw filled rects - just iterate
+    //       in the x direction. The base rect fill (in grBuffer) calls this
+    //       method x1-x0 times, and each of those calls has some overhead. So
+    //       just iterating over each page - x1-x0 times here - saves overhead
+    //       costs.
+    //
+    //       To make this work, make sure x0 > x1. Also, this method is wired in
+    //       as the draw_rect_filled entry in the draw interface. This is done
+    //       above in the init process.
+
+    int xinc;
+    if (x0 > x1)
+        swap_int(x0, x1);
+
+    // clip the x range (rect fills use this method)
+    if (x0 < m_clipX0)
+        x0 = m_clipX0;
+
+    if (x1 > m_clipX1)
+        x1 = m_clipX1;
+
+    if (x0 > x1) // out of bounds
+        return;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    // fills mask each column with the fill pattern
+    const uint8_t *pPattern = m_pSpanPattern ? m_pSpanPattern : solidPattern;
+    uint8_t colBits;
+
+    for (int i = page0; i <= page1; i++)
+    {
+        startBit = mod_byte(y0); // start bit in this byte
+
+        // last bit of this byte to set? Does the line end in this byte, or continue
+        // on...
+        endBit = y0 + kByteNBits - startBit > y1 ? mod_byte(y1) : kByteNBits - 1;
+
+        // Set the bits from startBit to endBit
+        setBits = (0xFF >> ((kByteNBits - endBit) - 1)) & (0xFF << startBit); // what bits are being set in this byte
+
+        // set the bits in the graphics buffer using the current byte operator
+        // function
+
+        // Note - We iterate over x to fill in a rect if specified.
+        for (xinc = x0; xinc <= x1; xinc++)
+        {
+            colBits = setBits & pPattern[mod_byte(xinc)];
+            curROP(m_pBuffer + i * m_viewport.width + xinc, (clr ? colBits : 0), colBits);
+        }
+
+        y0 += endBit - startBit + 1; // increment Y0 to next page
+
+        markDirty(i, x0, x1); // mark dirty tiles in page
+    }
+}
+////////////////////////////////////////////////////////////////////////////////////////
+// draw_rect_fill()
+//
+// Does the actual drawing/logic
+
+void QwGrPageDevice::drawRectFilled(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr)
+{
+    uint8_t x1 = x0 + width - 1;
+    uint8_t y1 = y0 + height - 1;
+
+    // just call vert line - with the fill pattern
+    m_pSpanPattern = m_pFillPattern;
+    drawLineVert(x0, y0, x1, y1, clr);
+    m_pSpanPattern = nullptr;
+}
+////////////////////////////////////////////////////////////////////////////////////////
+// drawCircleFilled()
+//
+// The circle is filled with vertical spans - set the fill pattern for them
+
+void QwGrPageDevice::drawCircleFilled(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr)
+{
+    m_pSpanPattern = m_pFillPattern;
+    QwGrBufferDevice::drawCircleFilled(x0, y0, radius, clr);
+    m_pSpanPattern = nullptr;
+}
+////////////////////////////////////////////////////////////////////////////////////
+// draw_bitmap()
+//
+// Draw a 8 bit encoded (aka same y layout as this device) bitmap to the screen
+//
+
+void QwGrPageDevice::drawBitmap(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t dst_height, uint8_t *pBitmap,
+                                uint8_t bmp_width, uint8_t bmp_height)
+{
+    drawBitmapMasked(x0, y0, dst_width, dst_height, pBitmap, nullptr, bmp_width, bmp_height);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_bitmap_masked()
+//
+// Draw a 8 bit encoded bitmap to the screen. If a mask is provided - same size
+// and layout as the bitmap - only pixels with a mask bit set are written.
+//
+
+void QwGrPageDevice::drawBitmapMasked(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t dst_height,
+                                      uint8_t *pBitmap, uint8_t *pMask, uint8_t bmp_width, uint8_t bmp_height)
+{
+    // some simple checks
+    if (x0 > m_clipX1 || y0 > m_clipY1 || !bmp_width || !bmp_height || !dst_width || !dst_height)
+        return;
+
+    if (bmp_width < dst_width)
+        dst_width = bmp_width;
+
+    if (bmp_height < dst_height)
+        dst_height = bmp_height;
+
+    // current position in the bitmap
+    uint8_t bmp_x = 0;
+    uint8_t bmp_y = 0;
+    uint8_t bmp_x0 = 0; // first bitmap column drawn
+
+    // Clip to the clip rect. If the left or top of the bitmap is clipped, start
+    // the copy at an offset into the bitmap
+    if (x0 < m_clipX0)
+    {
+        if (x0 + dst_width <= m_clipX0)
+            return; // nothing visible
+        bmp_x0 = m_clipX0 - x0;
+        dst_width -= bmp_x0;
+        x0 = m_clipX0;
+    }
+    if (y0 < m_clipY0)
+    {
+        if (y0 + dst_height <= m_clipY0)
+            return; // nothing visible
+        bmp_y = m_clipY0 - y0;
+        dst_height -= bmp_y;
+        y0 = m_clipY0;
+    }
+    if (x0 + dst_width - 1 > m_clipX1) // out of bounds
+        dst_width = m_clipX1 - x0 + 1;
+
+    if (y0 + dst_height - 1 > m_clipY1) // out of bounds
+        dst_height = m_clipY1 - y0 + 1;
+
+    uint8_t page0, page1;
+    uint8_t startBit, endBit, grSetBits, grStartBit;
+
+    uint8_t bmp_mask[2], bmp_data, mask_data, bmpPage, setBits;
+    uint16_t bmp_offset;
+    uint8_t remainingBits, neededBits;
+
+    uint8_t y1 = y0 + dst_height - 1;
+
+    page0 = y0 / kByteNBits;
+    page1 = y1 / kByteNBits;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    // The Plan:
+    //   - Walk down the graphics buffer range (y) one page at a time
+    //   - For each page
+    //          - Determine needed number of bits for the destination
+    //          - Determine what bits to pull from the bitmap
+    //              - Create a mask to pull out bits - from one or two bytes
+    //          - Loop over the x dimension
+    //              - pull bits from bitmap, build byte of data of bitmap bits, in
+    //                right order for the destination (graphics buffer)
+    //              - Write the bitmap bits to the graphis buffer using the
+    //              current operator
+
+    // Loop over the memory pages in the graphics buffer
+    for (int iPage = page0; iPage <= page1; iPage++)
+    {
+        // First, get the number of destination bits in the current page
+        grStartBit = mod_byte(y0); // start bit
+
+        // last bit of this byte to set? Does the copy region end in this byte, or
+        // continue on...
+        endBit = y0 + kByteNBits - grStartBit > y1 ? mod_byte(y1) : kByteNBits - 1;
+
+        // Set the bits from startBit to endBit
+        grSetBits = (0xFF >> (kByteNBits - endBit - 1)) & (0xFF << grStartBit); // what bits are being set in this byte
+
+        // how many bits of data do we need to transfer from the bitmap?
+        neededBits = endBit - grStartBit + 1;
+
+        // Okay, we have how much data to transfer to the current page. Now build
+        // the data from the bitmap.
+
+        // First, build bit masks for pulling the data out of the bmp array. The
+        // data might straddle two bytes, so build two masks
+
+        // as above, get the start and end bites for the current position in the
+        // bmp.
+        startBit = mod_byte(bmp_y);
+        endBit = (kByteNBits - startBit > neededBits ? startBit + neededBits : kByteNBits) - 1;
+
+        // Set the bits from startBit to endBit
+        bmp_mask[0] = (0xFF >> (kByteNBits - endBit - 1)) & (0xFF << startBit);
+
+        // any remaining bits to get?
+        remainingBits = neededBits - (endBit - startBit + 1); // +1 - needsBits is 1's based
+        bmp_mask[1] = 0xFF >> (kByteNBits - remainingBits);
+
+        // What row in the source bitmap
+        bmpPage = bmp_y / kByteNBits;
+
+        // we have the mask for the bmp - loop over the width of the copy region,
+        // pulling out bmp data and writing it to the graphics buffer
+        for (bmp_x = 0; bmp_x < dst_width; bmp_x++)
+        {
+            // get data bits out of current bitmap location and shift if needed
+            bmp_offset = bmp_width * bmpPage + bmp_x0 + bmp_x;
+            bmp_data = (pBitmap[bmp_offset] & bmp_mask[0]) >> startBit;
+
+            if (remainingBits) // more data to add from the next byte in this column
+                bmp_data |= (pBitmap[bmp_offset + bmp_width] & bmp_mask[1]) << (neededBits - remainingBits);
+
+            // if masked, only write the bits set in the mask
+            setBits = grSetBits;
+            if (pMask)
+            {
+                mask_data = (pMask[bmp_offset] & bmp_mask[0]) >> startBit;
+
+                if (remainingBits)
+                    mask_data |= (pMask[bmp_offset + bmp_width] & bmp_mask[1]) << (neededBits - remainingBits);
+
+                setBits &= mask_data << grStartBit;
+            }
+
+            // Write the bmp data to the graphics buffer - using current write op.
+            // Note, if the location in the buffer didn't start at bit 0, we shift
+            // bmp_data
+            curROP(m_pBuffer + iPage * m_viewport.width + bmp_x + x0, bmp_data << grStartBit, setBits);
+        }
+        // move up our y values (graphics buffer and bitmap) by the number of bits
+        // transferred
+        y0 += neededBits;
+        bmp_y += neededBits;
+
+        markDirty(iPage, x0, x0 + dst_width - 1); // mark dirty tiles in page
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// transpose8x8()
+//
+// Transpose an 8x8 block of pixels in place - on input, byte i is row i with the
+// left pixel in bit 0. On output, byte j is column j with the top pixel in bit 0 -
+// a graphics buffer byte.
+//
+// This is done 32 bits at a time (SWAR) - rows 0-3 in one value, rows 4-7 in a second.
+// Each step swaps the off-diagonal blocks of the 2x2, 4x4 and then 8x8 sub-matrices.
+
+static void transpose8x8(uint8_t *pBlock)
+{
+    uint32_t lo = (uint32_t)pBlock[0] | (uint32_t)pBlock[1] << 8 | (uint32_t)pBlock[2] << 16 |
+                  (uint32_t)pBlock[3] << 24;
+    uint32_t hi = (uint32_t)pBlock[4] | (uint32_t)pBlock[5] << 8 | (uint32_t)pBlock[6] << 16 |
+                  (uint32_t)pBlock[7] << 24;
+    uint32_t t;
+
+    // 2x2 blocks
+    t = (lo ^ (lo >> 7)) & 0x00AA00AA;
+    lo ^= t ^ (t << 7);
+    t = (hi ^ (hi >> 7)) & 0x00AA00AA;
+    hi ^= t ^ (t << 7);
+
+    // 4x4 blocks
+    t = (lo ^ (lo >> 14)) & 0x0000CCCC;
+    lo ^= t ^ (t << 14);
+    t = (hi ^ (hi >> 14)) & 0x0000CCCC;
+    hi ^= t ^ (t << 14);
+
+    // 8x8 - swap the upper right 4x4 block (in lo) with the lower left (in hi)
+    t = (lo ^ (hi << 4)) & 0xF0F0F0F0;
+    lo ^= t;
+    hi ^= t >> 4;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        pBlock[i] = lo >> (i * kByteNBits);
+        pBlock[i + 4] = hi >> (i * kByteNBits);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_bitmap_rows()
+//
+// Draw a row major bitmap - XBM (left pixel in bit 0) or PBM (left pixel in bit 7).
+// Each row of the bitmap is (bmp_width + 7)/8 bytes.
+//
+// The Plan:
+//   - Clip to the clip rect, moving the start position in the bitmap with the clip
+//   - Walk down the bitmap 8 rows at a time. These 8 rows land in one graphics
+//     buffer page, or straddle two pages if not page aligned.
+//   - For each byte of the rows, transpose the 8x8 block into 8 graphics buffer bytes
+//     and write them using the current raster op - shifted into the page(s).
+
+void QwGrPageDevice::drawBitmapRows(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t dst_height,
+                                    uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height, uint8_t format)
+{
+    // some simple checks
+    if (!pBitmap || x0 > m_clipX1 || y0 > m_clipY1 || !bmp_width || !bmp_height || !dst_width || !dst_height)
+        return;
+
+    if (bmp_width < dst_width)
+        dst_width = bmp_width;
+
+    if (bmp_height < dst_height)
+        dst_height = bmp_height;
+
+    // first bitmap column and row drawn
+    uint8_t bmp_x0 = 0;
+    uint8_t bmp_y0 = 0;
+
+    if (x0 < m_clipX0)
+    {
+        if (x0 + dst_width <= m_clipX0)
+            return; // nothing visible
+        bmp_x0 = m_clipX0 - x0;
+        dst_width -= bmp_x0;
+        x0 = m_clipX0;
+    }
+    if (y0 < m_clipY0)
+    {
+        if (y0 + dst_height <= m_clipY0)
+            return; // nothing visible
+        bmp_y0 = m_clipY0 - y0;
+        dst_height -= bmp_y0;
+        y0 = m_clipY0;
+    }
+    if (x0 + dst_width - 1 > m_clipX1)
+        dst_width = m_clipX1 - x0 + 1;
+
+    if (y0 + dst_height - 1 > m_clipY1)
+        dst_height = m_clipY1 - y0 + 1;
+
+    uint8_t stride = (bmp_width + kByteNBits - 1) / kByteNBits; // bytes per bitmap row
+    bool bMSBFirst = format == grBitmapPBM;
+
+    uint8_t block[kByteNBits];
+    uint8_t nRows, shift, page, setBits0, setBits1, bmpCol, bit0, nCols, data, k;
+    uint8_t *pRows, *pDest0, *pDest1;
+    uint16_t y;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    for (uint16_t band = 0; band < dst_height; band += kByteNBits)
+    {
+        // rows in this band, and where they land in the graphics buffer
+        nRows = dst_height - band < kByteNBits ? dst_height - band : kByteNBits;
+        y = y0 + band;
+        page = y / kByteNBits;
+        shift = mod_byte(y);
+
+        setBits0 = (0xFF >> (kByteNBits - nRows)) << shift;
+        setBits1 = shift ? (0xFF >> (kByteNBits - nRows)) >> (kByteNBits - shift) : 0;
+
+        pDest0 = m_pBuffer + page * m_viewport.width + x0;
+        pDest1 = pDest0 + m_viewport.width;
+
+        pRows = pBitmap + (bmp_y0 + band) * stride;
+
+        for (uint8_t x = 0; x < dst_width; x += nCols)
+        {
+            // the bitmap byte holding this column - and the columns used from it
+            bmpCol = (bmp_x0 + x) / kByteNBits;
+            bit0 = mod_byte((bmp_x0 + x));
+            nCols = kByteNBits - bit0 < dst_width - x ? kByteNBits - bit0 : dst_width - x;
+
+            for (k = 0; k < kByteNBits; k++)
+                block[k] = k < nRows ? pRows[k * stride + bmpCol] : 0;
+
+            transpose8x8(block);
+
+            for (k = 0; k < nCols; k++)
+            {
+                data = block[bMSBFirst ? kByteNBits - 1 - bit0 - k : bit0 + k];
+
+                curROP(pDest0 + x + k, data << shift, setBits0);
+
+                if (setBits1)
+                    curROP(pDest1 + x + k, data >> (kByteNBits - shift), setBits1);
+            }
+        }
+        markDirty(page, x0, x0 + dst_width - 1);
+
+        if (setBits1)
+            markDirty(page + 1, x0, x0 + dst_width - 1);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Run length encoded bitmaps
+//
+// A small decoder for the RLE bitmap stream (see qwiic_resdef.h for the format).
+// Data is decoded a byte at a time, straight from PROGMEM, so no buffer for the
+// full bitmap is needed.
+
+// Number of columns decoded before they are drawn
+#define kRLEChunkBytes 16
+
+struct rleStream_t
+{
+    const uint8_t *pData; // next byte in the stream
+    uint8_t count;        // bytes left in the current packet
+    bool repeat;          // current packet is a run of value
+    uint8_t value;
+};
+
+static void rleStart(rleStream_t &stream)
+{
+    if (!stream.count)
+    {
+        uint8_t control = pgm_read_byte(stream.pData++);
+
+        stream.repeat = control & 0x80;
+        if (stream.repeat)
+        {
+            stream.count = (control & 0x7F) + 2;
+            stream.value = pgm_read_byte(stream.pData++);
+        }
+        else
+            stream.count = control + 1;
+    }
+}
+
+static uint8_t rleNext(rleStream_t &stream)
+{
+    rleStart(stream);
+    stream.count--;
+
+    return stream.repeat ? stream.value : pgm_read_byte(stream.pData++);
+}
+
+// skip bytes - whole packets at a time
+static void rleSkip(rleStream_t &stream, uint16_t nSkip)
+{
+    uint8_t n;
+    while (nSkip)
+    {
+        rleStart(stream);
+
+        n = nSkip < stream.count ? nSkip : stream.count;
+        if (!stream.repeat)
+            stream.pData += n;
+
+        stream.count -= n;
+        nSkip -= n;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_bitmap_rle()
+//
+// Draw a run length encoded bitmap - the data is in the page layout.
+//
+// The Plan:
+//   - Clip to the clip rect, moving the start position in the bitmap with the clip
+//   - For each bitmap row in the visible area, skip to the first visible column
+//   - Decode the visible columns a chunk at a time, shift out the rows above the
+//     visible area and draw the chunk with the bitmap kernel - which places it in
+//     the graphics buffer pages with the current raster op.
+
+void QwGrPageDevice::drawBitmapRLE(uint8_t x0, uint8_t y0, uint8_t dst_width, uint8_t dst_height,
+                                   uint8_t *pBitmap, uint8_t bmp_width, uint8_t bmp_height)
+{
+    // some simple checks
+    if (!pBitmap || x0 > m_clipX1 || y0 > m_clipY1 || !bmp_width || !bmp_height || !dst_width || !dst_height)
+        return;
+
+    if (bmp_width < dst_width)
+        dst_width = bmp_width;
+
+    if (bmp_height < dst_height)
+        dst_height = bmp_height;
+
+    // first bitmap column and row drawn
+    uint8_t bmp_x0 = 0;
+    uint8_t bmp_y0 = 0;
+
+    if (x0 < m_clipX0)
+    {
+        if (x0 + dst_width <= m_clipX0)
+            return; // nothing visible
+        bmp_x0 = m_clipX0 - x0;
+        dst_width -= bmp_x0;
+        x0 = m_clipX0;
+    }
+    if (y0 < m_clipY0)
+    {
+        if (y0 + dst_height <= m_clipY0)
+            return; // nothing visible
+        bmp_y0 = m_clipY0 - y0;
+        dst_height -= bmp_y0;
+        y0 = m_clipY0;
+    }
+    if (x0 + dst_width - 1 > m_clipX1)
+        dst_width = m_clipX1 - x0 + 1;
+
+    if (y0 + dst_height - 1 > m_clipY1)
+        dst_height = m_clipY1 - y0 + 1;
+
+    uint8_t chunk[kRLEChunkBytes];
+    uint8_t bmpRow0 = bmp_y0 / kByteNBits;
+    uint8_t bmpRow1 = (bmp_y0 + dst_height - 1) / kByteNBits;
+    uint8_t nCols, shift, rowY0, rowY1, i;
+
+    rleStream_t stream = {pBitmap, 0, false, 0};
+
+    // move to the first visible byte
+    rleSkip(stream, bmpRow0 * bmp_width + bmp_x0);
+
+    for (uint8_t bmpRow = bmpRow0; bmpRow <= bmpRow1; bmpRow++)
+    {
+        // the visible rows of the bitmap in this bitmap row
+        rowY0 = bmpRow == bmpRow0 ? mod_byte(bmp_y0) : 0;
+        rowY1 = bmpRow == bmpRow1 ? mod_byte((bmp_y0 + dst_height - 1)) : kByteNBits - 1;
+        shift = rowY0;
+
+        for (uint8_t x = 0; x < dst_width; x += nCols)
+        {
+            nCols = dst_width - x < kRLEChunkBytes ? dst_width - x : kRLEChunkBytes;
+
+            for (i = 0; i < nCols; i++)
+                chunk[i] = rleNext(stream) >> shift;
+
+            drawBitmapMasked(x0 + x, y0 + bmpRow * kByteNBits + rowY0 - bmp_y0, nCols, rowY1 - rowY0 + 1, chunk,
+                             nullptr, nCols, rowY1 - rowY0 + 1);
+        }
+        // on to the first visible column of the next row
+        if (bmpRow < bmpRow1)
+            rleSkip(stream, bmp_width - dst_width);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_text()
+//
+// Draw text - writing the glyph columns of the current font as whole bytes.
+//
+// The Plan:
+//   - Walk the string, moving the pen position by the advance of each glyph and the
+//     kerning between characters. Glyphs outside of the clip rect are skipped.
+//   - Write each glyph with drawGlyph() - each byte of font data is shifted into
+//     the one or two graphics buffer pages it lands in.
+//   - Once done, mark the tiles covered by the drawn glyphs dirty - once per page
+//     for the whole string.
+//
+// Scaled text takes the same path, with the glyph metrics multiplied by the scale.
+
+void QwGrPageDevice::drawText(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr)
+{
+    drawTextScaled(x0, y0, text, length, 1, clr);
+}
+
+void QwGrPageDevice::drawTextScaled(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t scale,
+                                    uint8_t clr)
+{
+    // check things
+    if (!m_currentFont || !text || !*text || y0 > m_clipY1)
+        return;
+
+    uint8_t nRows = m_currentFont->height / kByteNBits;
+    if (!nRows)
+        nRows = 1;
+
+    QwGlyph theGlyph;
+    const char *pEnd = (length == kTextToEnd ? nullptr : text + length);
+    int16_t x = x0; // pen position
+    int16_t xGlyph, xMin = m_clipX1 + 1, xMax = -1, glyphWidth;
+    uint16_t code, prevCode = 0;
+
+    while ((!pEnd || text < pEnd) && *text)
+    {
+        code = qwNextCode(text); // UTF-8
+
+        // characters that aren't in the font are blank
+        m_currentFont->glyph(code, theGlyph);
+
+        if (prevCode)
+            x += m_currentFont->kerning(prevCode, code) * scale;
+        prevCode = code;
+
+        xGlyph = x + theGlyph.xOffset * scale;
+        x += theGlyph.advance * scale;
+        glyphWidth = theGlyph.width * scale;
+
+        // blank, or outside of the clip rect?
+        if (!glyphWidth || xGlyph > m_clipX1 || xGlyph + glyphWidth <= m_clipX0)
+            continue;
+
+        if (scale == 1)
+            drawGlyph(xGlyph, y0, theGlyph, nRows, clr);
+        else
+            drawGlyphScaled(xGlyph, y0, theGlyph, nRows, scale, clr);
+
+        if (xGlyph < xMin)
+            xMin = xGlyph;
+        if (xGlyph + glyphWidth - 1 > xMax)
+            xMax = xGlyph + glyphWidth - 1;
+    }
+    if (xMin > xMax) // nothing drawn
+        return;
+
+    // dirty tiles - for the columns and pages drawn
+    if (xMin < m_clipX0)
+        xMin = m_clipX0;
+    if (xMax > m_clipX1)
+        xMax = m_clipX1;
+
+    uint16_t y1 = y0 + nRows * kByteNBits * scale - 1;
+    if (y1 > m_clipY1)
+        y1 = m_clipY1;
+
+    for (uint8_t page = (y0 < m_clipY0 ? m_clipY0 : y0) / kByteNBits; page <= y1 / kByteNBits; page++)
+        markDirty(page, xMin, xMax);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_glyph()
+//
+// Write the columns of a glyph to the graphics buffer, using the current raster op.
+// The glyph is nRows rows of font data, stride bytes apart - in PROGMEM, or in RAM for
+// a glyph decoded by the font. Only the bits set in the glyph are written - with the
+// value of clr.
+//
+// A row of font data lands in one page if y0 is page aligned, or is split across two.
+// Columns and rows outside of the clip rect aren't written.
+
+void QwGrPageDevice::drawGlyph(int16_t x0, uint16_t y0, const QwGlyph &theGlyph, uint8_t nRows, uint8_t clr)
+{
+    // the columns of the glyph inside the clip rect - the caller makes sure some are
+    uint8_t col0 = x0 < m_clipX0 ? m_clipX0 - x0 : 0;
+    uint8_t col1 = x0 + theGlyph.width - 1 > m_clipX1 ? m_clipX1 - x0 : theGlyph.width - 1;
+
+    uint8_t shift = mod_byte(y0);
+    uint16_t page = y0 / kByteNBits;
+    uint16_t y;
+    uint8_t clipMask, data, lo, hi, i;
+    uint8_t *pDest;
+    const uint8_t *pGlyph = theGlyph.pData;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    for (uint8_t row = 0; row < nRows; row++, page++, pGlyph += theGlyph.stride)
+    {
+        // mask of the rows of this band inside the clip rect
+        y = y0 + row * kByteNBits;
+        if (y > m_clipY1)
+            break;
+
+        if (y + kByteNBits - 1 < m_clipY0)
+            continue;
+
+        clipMask = 0xFF;
+        if (y < m_clipY0)
+            clipMask <<= m_clipY0 - y;
+        if (y + kByteNBits - 1 > m_clipY1)
+            clipMask &= 0xFF >> (y + kByteNBits - 1 - m_clipY1);
+
+        pDest = m_pBuffer + page * m_viewport.width + x0 + col0;
+
+        for (i = col0; i <= col1; i++, pDest++)
+        {
+            data = (theGlyph.inRAM ? pGlyph[i] : pgm_read_byte(pGlyph + i)) & clipMask;
+            if (!data)
+                continue;
+
+            lo = data << shift;
+            if (lo)
+                curROP(pDest, clr ? lo : 0, lo);
+
+            // rest of the glyph byte goes in the next page
+            hi = shift ? data >> (kByteNBits - shift) : 0;
+            if (hi)
+                curROP(pDest + m_viewport.width, clr ? hi : 0, hi);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_glyph_scaled()
+//
+// Write a glyph with each font pixel scaled to a scale x scale block. A byte of font
+// data - 8 rows - is expanded to scale bytes with lookup tables that repeat each bit
+// scale times, a nibble at a time. Each expanded byte is then written like a glyph
+// byte in drawGlyph(), to scale columns.
+
+// nibble -> each bit repeated 2, 3 and 4 times
+static const uint8_t scale2Bits[16] = {0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+                                       0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+static const uint16_t scale3Bits[16] = {0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+                                        0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF};
+static const uint16_t scale4Bits[16] = {0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+                                        0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF};
+
+void QwGrPageDevice::drawGlyphScaled(int16_t x0, uint16_t y0, const QwGlyph &theGlyph, uint8_t nRows, uint8_t scale,
+                                     uint8_t clr)
+{
+    uint8_t shift = mod_byte(y0);
+    uint16_t y, page;
+    int16_t x;
+    uint32_t bits;
+    uint8_t clipMask, data, lo, hi, i, b, k;
+    uint8_t *pDest;
+    const uint8_t *pGlyph = theGlyph.pData;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    for (uint8_t row = 0; row < nRows; row++, pGlyph += theGlyph.stride)
+    {
+        for (i = 0; i < theGlyph.width; i++)
+        {
+            data = theGlyph.inRAM ? pGlyph[i] : pgm_read_byte(pGlyph + i);
+            if (!data)
+                continue;
+
+            if (scale == 2)
+                bits = scale2Bits[data & 0x0F] | scale2Bits[data >> 4] << 8;
+            else if (scale == 3)
+                bits = scale3Bits[data & 0x0F] | (uint32_t)scale3Bits[data >> 4] << 12;
+            else
+                bits = scale4Bits[data & 0x0F] | (uint32_t)scale4Bits[data >> 4] << 16;
+
+            // each expanded byte - 8 rows of the block
+            for (b = 0; b < scale; b++, bits >>= kByteNBits)
+            {
+                y = y0 + (row * scale + b) * kByteNBits;
+                if (y > m_clipY1)
+                    break;
+
+                if (!(bits & 0xFF) || y + kByteNBits - 1 < m_clipY0)
+                    continue;
+
+                clipMask = 0xFF;
+                if (y < m_clipY0)
+                    clipMask <<= m_clipY0 - y;
+                if (y + kByteNBits - 1 > m_clipY1)
+                    clipMask &= 0xFF >> (y + kByteNBits - 1 - m_clipY1);
+
+                data = bits & clipMask;
+                lo = data << shift;
+                hi = shift ? data >> (kByteNBits - shift) : 0;
+                page = y / kByteNBits;
+
+                // the block columns
+                for (k = 0, x = x0 + i * scale; k < scale; k++, x++)
+                {
+                    if (x < m_clipX0 || x > m_clipX1)
+                        continue;
+
+                    pDest = m_pBuffer + page * m_viewport.width + x;
+                    if (lo)
+                        curROP(pDest, clr ? lo : 0, lo);
+                    if (hi)
+                        curROP(pDest + m_viewport.width, clr ? hi : 0, hi);
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// bitmapMasked()
+//
+// Draw a bitmap, writing only the pixels set in the provided mask. The mask is
+// the same size and layout as the bitmap. A null mask draws the full bitmap.
+
+void QwGrPageDevice::bitmapMasked(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t *pMask, uint8_t bmp_width,
+                                  uint8_t bmp_height)
+{
+    if (!m_pBuffer || !pBitmap)
+        return;
+
+    drawBitmapMasked(x0, y0, bmp_width, bmp_height, pBitmap, pMask, bmp_width, bmp_height);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// saveRect()
+//
+// Copy a rectangle of the graphics buffer into a bitmap - same layout as the
+// buffer, with the top row of the rect at bit 0 of the first bitmap row. The
+// bitmap needs width * (height + 7)/8 bytes.
+//
+// Drawing this bitmap at x0, y0 with the copy raster op restores the rect.
+// Areas outside of the screen are saved as 0.
+
+void QwGrPageDevice::saveRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t *pSave)
+{
+    if (!m_pBuffer || !pSave)
+        return;
+
+    uint8_t nRows = (height + kByteNBits - 1) / kByteNBits; // rows in the bitmap
+    uint8_t shift = mod_byte(y0);
+    uint16_t page, x;
+    uint8_t *pPage;
+
+    for (uint8_t iRow = 0; iRow < nRows; iRow++)
+    {
+        page = y0 / kByteNBits + iRow;
+        pPage = m_pBuffer + page * m_viewport.width;
+
+        for (x = x0; x < x0 + width; x++, pSave++)
+        {
+            *pSave = 0;
+            if (x >= m_viewport.width)
+                continue;
+
+            // the row straddles two pages when not page aligned
+            if (page < m_nPages)
+                *pSave = pPage[x] >> shift;
+
+            if (shift && page + 1 < m_nPages)
+                *pSave |= pPage[x + m_viewport.width] << (kByteNBits - shift);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// copyRect()
+//
+// Copy a rect of the graphics buffer to another location in the buffer, using the
+// current raster op. Overlapping source and destination areas are supported.
+
+void QwGrPageDevice::copyRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t x1, uint8_t y1)
+{
+    if (!m_pBuffer)
+        return;
+
+    drawBlock(m_pBuffer, m_viewport.width, m_viewport.height, x0, y0, width, height, x1, y1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// copyRect()
+//
+// Copy a rect from the graphics buffer of another page device to this device's
+// buffer, using the current raster op.
+
+void QwGrPageDevice::copyRect(QwGrPageDevice &source, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height,
+                              uint8_t x1, uint8_t y1)
+{
+    if (!m_pBuffer || !source.m_pBuffer)
+        return;
+
+    drawBlock(source.m_pBuffer, source.m_viewport.width, source.m_viewport.height, x0, y0, width, height, x1, y1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// draw_block()
+//
+// Block transfer (BitBlt) from a page organized source buffer to the graphics
+// buffer. The source is srcWidth bytes wide and srcHeight pixels tall. The rect at
+// src_x, src_y is written to x0, y0 using the current raster op.
+//
+// The Plan:
+//   - Clip the destination to the clip rect, and the source to the source buffer
+//   - Walk the destination pages. Each destination page gets its bits from at most
+//     two source pages - the vertical offset between source and destination is the
+//     same for every page, so the shift is computed once.
+//   - For each column, build the destination byte from the two source bytes, and
+//     write it using the current raster op, masked to the rows of the rect.
+//
+// If the source is the graphics buffer, the rects can overlap. A destination page
+// only reads source pages on the side of the copy direction. So, walking the pages
+// in the opposite direction of the move - and columns the same way - means source
+// data is always read before it's overwritten.
+
+void QwGrPageDevice::drawBlock(const uint8_t *pSrc, uint8_t srcWidth, uint8_t srcHeight, uint8_t src_x,
+                               uint8_t src_y, uint8_t width, uint8_t height, uint8_t x0, uint8_t y0)
+{
+    if (!pSrc || !width || !height || x0 > m_clipX1 || y0 > m_clipY1)
+        return;
+
+    // Clip to the clip rect - moving the source with the destination
+    if (x0 < m_clipX0)
+    {
+        if (x0 + width <= m_clipX0)
+            return;
+        width -= m_clipX0 - x0;
+        src_x += m_clipX0 - x0;
+        x0 = m_clipX0;
+    }
+    if (y0 < m_clipY0)
+    {
+        if (y0 + height <= m_clipY0)
+            return;
+        height -= m_clipY0 - y0;
+        src_y += m_clipY0 - y0;
+        y0 = m_clipY0;
+    }
+    if (x0 + width - 1 > m_clipX1)
+        width = m_clipX1 - x0 + 1;
+
+    if (y0 + height - 1 > m_clipY1)
+        height = m_clipY1 - y0 + 1;
+
+    // Clip to the source buffer
+    if (src_x >= srcWidth || src_y >= srcHeight)
+        return;
+
+    if (src_x + width > srcWidth)
+        width = srcWidth - src_x;
+
+    if (src_y + height > srcHeight)
+        height = srcHeight - src_y;
+
+    uint8_t srcPages = (srcHeight + kByteNBits - 1) / kByteNBits;
+
+    uint8_t y1 = y0 + height - 1;
+    uint8_t page0 = y0 / kByteNBits;
+    uint8_t page1 = y1 / kByteNBits;
+
+    // direction of travel - against the move, so overlapping data is read first
+    int8_t pageInc = (y0 > src_y) ? -1 : 1;
+    int8_t xInc = (x0 > src_x) ? -1 : 1;
+
+    // offset from destination rows to source rows - made positive by adding
+    // a whole number of pages, so the page and shift math uses unsigned values
+    int16_t offset = (int16_t)src_y - y0 + kMaxPageOffset;
+
+    uint8_t setBits, srcShift;
+    uint8_t srcData, startBit, endBit;
+    int16_t srcPage;
+    const uint8_t *pSrc0, *pSrc1;
+    uint8_t *pDest;
+
+    rasterOPsFn curROP = m_rasterOps[m_rop]; // current raster op
+
+    for (int iPage = (pageInc > 0 ? page0 : page1); iPage >= page0 && iPage <= page1; iPage += pageInc)
+    {
+        // the rows of the rect in this page
+        startBit = iPage == page0 ? mod_byte(y0) : 0;
+        endBit = iPage == page1 ? mod_byte(y1) : kByteNBits - 1;
+
+        setBits = (0xFF >> (kByteNBits - endBit - 1)) & (0xFF << startBit);
+
+        // The source rows for this page start in srcPage, at bit srcShift
+        srcPage = (iPage * kByteNBits + offset) / kByteNBits - kMaxPageOffset / kByteNBits;
+        srcShift = mod_byte((iPage * kByteNBits + offset));
+
+        // source page pointers - nullptr is outside of the source buffer
+        pSrc0 = (srcPage >= 0 && srcPage < srcPages) ? pSrc + srcPage * srcWidth + src_x : nullptr;
+        pSrc1 = (srcShift && srcPage + 1 >= 0 && srcPage + 1 < srcPages) ? pSrc + (srcPage + 1) * srcWidth + src_x
+                                                                         : nullptr;
+
+        pDest = m_pBuffer + iPage * m_viewport.width + x0;
+
+        for (int i = (xInc > 0 ? 0 : width - 1); i >= 0 && i < width; i += xInc)
+        {
+            srcData = pSrc0 ? pSrc0[i] >> srcShift : 0;
+
+            if (pSrc1)
+                srcData |= pSrc1[i] << (kByteNBits - srcShift);
+
+            curROP(pDest + i, srcData, setBits);
+        }
+
+        markDirty(iPage, x0, x0 + width - 1); // mark dirty tiles in page
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Device Update Methods
+////////////////////////////////////////////////////////////////////////////////////
+// display()
+//
+// Send the "dirty" areas of the graphics buffer to the device's screen buffer.
+// Only send the areas that need to be updated. The update region is based on
+// new graphics to display, and any currently displayed items that need to be
+// erased.
+
+void QwGrPageDevice::display()
+{
+    if (!m_pBuffer)
+        return;
+
+    // Loop over our pages - for each run of dirty tiles in a page, send the
+    // graphics buffer for the run to the device
+
+    uint32_t bits;
+    uint8_t tile, tile0, tile1;
+    uint16_t x0, x1;
+    uint8_t *pDirty, *pErase;
+
+    if (m_transposed)
+        displayTransposed();
+
+    for (uint8_t i = 0; i < m_nPages; i++)
+    {
+        if (!m_transposed)
+        {
+            // We keep the erase map seperate from dirty map. Make a copy of the
+            // dirty tiles, expand to include erase tiles if an erase happened
+            bits = dirtyTiles(i);
+
+            tile = 0;
+            while (nextTileRun(bits, tile, tile0, tile1, true))
+            {
+                x0 = tile0 * kTileWidth;
+                x1 = tile1 * kTileWidth + kTileWidth - 1;
+                if (x1 >= m_viewport.width) // last tile can be partial
+                    x1 = m_viewport.width - 1;
+
+                // send the dirty data to the device
+                transferRun(i, x0, m_pBuffer + i * m_viewport.width + x0, x1 - x0 + 1);
+            }
+        }
+
+        // Update the erase map - if we sent the erase tiles, these areas are now clear.
+        // Add the just sent dirty tiles (non erase) to the erase map. This page is
+        // then no longer dirty.
+        pDirty = tilePageRow(m_tileDirty, i);
+        pErase = tilePageRow(m_tileErase, i);
+
+        for (tile = 0; tile < m_tileStride; tile++)
+        {
+            pErase[tile] = (m_pendingErase ? 0 : pErase[tile]) | pDirty[tile];
+            pDirty[tile] = 0;
+        }
+    }
+    m_pendingErase = false; // no longer pending
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// displayTransposed()
+//
+// Send the dirty tiles of a transposed (90 degree rotated) graphics buffer. A tile is
+// 8x8 pixels, so each tile of the buffer turns into one tile of the device screen
+// buffer:
+//
+//      - A column of tiles in the buffer is a page of the device. The tiles of the
+//        column, bottom page first, are the tiles of the device page, left to right.
+//      - Each tile is transposed as it's sent - bit b of column j of the device tile is
+//        bit (7 - j) of column b of the buffer tile. The tile is turned with
+//        transpose8x8(), and its columns taken in reverse order.
+//
+// Dirty tiles next to each other on a device page are sent as one run.
+
+void QwGrPageDevice::displayTransposed(void)
+{
+    uint8_t run[kTileWidth * kByteNBits]; // up to 8 tiles per transfer
+    uint8_t block[kTileWidth];
+    uint8_t devPage, tile, lastTile = m_nPages - 1, nTiles, j;
+    uint8_t *pDest;
+    const uint8_t *pSrc;
+
+    for (devPage = 0; devPage * kTileWidth < m_viewport.width; devPage++)
+    {
+        uint8_t tileByte = devPage / kByteNBits, tileBit = byte_bits[mod_byte(devPage)];
+
+        for (tile = 0; tile <= lastTile;)
+        {
+            // device tile -> buffer page, from the bottom up
+            nTiles = 0;
+            while (tile + nTiles <= lastTile && nTiles < kByteNBits &&
+                   ((tilePageRow(m_tileDirty, lastTile - tile - nTiles)[tileByte] |
+                     (m_pendingErase ? tilePageRow(m_tileErase, lastTile - tile - nTiles)[tileByte] : 0)) &
+                    tileBit))
+                nTiles++;
+
+            if (!nTiles)
+            {
+                tile++;
+                continue;
+            }
+            for (uint8_t i = 0; i < nTiles; i++)
+            {
+                pSrc = m_pBuffer + (lastTile - tile - i) * m_viewport.width + devPage * kTileWidth;
+                pDest = run + i * kTileWidth;
+
+                // byte j of the transposed block is bit j of each column - the device
+                // columns are in the reverse order
+                memcpy(block, pSrc, kTileWidth);
+                transpose8x8(block);
+                for (j = 0; j < kTileWidth; j++)
+                    pDest[j] = block[kTileWidth - 1 - j];
+            }
+            transferRun(devPage, tile * kTileWidth, run, nTiles * kTileWidth);
+            tile += nTiles;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// setTransposed()
+//
+// Protected - swap the width and height of the graphics buffer, for a device rotated
+// 90 degrees. Drawing works on the transposed buffer as usual, and display() turns
+// each tile as it's sent. The buffer is cleared. Needs a width and height that are
+// multiples of 8, and tile maps large enough for the transposed buffer.
+//
+// Returns false if the buffer can't be transposed.
+
+bool QwGrPageDevice::setTransposed(bool bTransposed)
+{
+    if (bTransposed == m_transposed)
+        return true;
+
+    if (!m_pBuffer || mod_byte(m_viewport.width) || mod_byte(m_viewport.height))
+        return false;
+
+    swap_int(m_viewport.width, m_viewport.height);
+
+    if (!setPageCount(m_viewport.height / kByteNBits))
+    {
+        swap_int(m_viewport.width, m_viewport.height);
+        setPageCount(m_viewport.height / kByteNBits);
+        return false;
+    }
+    m_transposed = bTransposed;
+
+    clearBuffers();
+    clearClipRect();
+
+    return true;
+}
@@ -0,0 +1,422 @@
+
+// qwiic_grpage.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+/*
+ * Header file for the page based graphics buffer device - the rasterizer shared
+ * by the page organized OLED drivers.
+ */
+
+#pragma once
+
+#include "qwiic_grbuffer.h"
+#include "qwiic_grcommon.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Buffer Management
+/////////////////////////////////////////////////////////////////////////////
+//
+// The graphics buffer is organized as a set of pages - each page is a stream
+// of bytes, and defined as follows:
+//
+//      - X pixel position is an offset in a byte array
+//      - Y pixel position is a bit in a byte, so a page can have 8 Y locations
+//
+// A pixel value of 1, turn on the corresponding pixel, 0 turns it off.
+//
+// >> Implementation <<
+//
+// To minimize data transfers to the device, the buffer is divided into 8x8
+// pixel tiles - a tile is 8 bytes (columns) of one page. A bitmap with one bit
+// per tile records the tiles that are changed by drawing operations. A 128x64
+// device needs 128 bits (16 bytes) for this map, a 128x128 device 256 bits.
+//
+// A second tile map records the tiles that contain graphics that have been sent
+// to the device - this is the region that must be cleared by erase().
+//
+// When the graphics buffer is transferred to the device, the following takes place:
+//
+//      For each page:
+//          - Find the runs of dirty tiles in the page. Runs separated by a
+//            small clean gap are merged - sending a few extra bytes costs less
+//            than setting a new device address.
+//          - Send each run to the device
+//          - Mark the page tiles as "clean"
+//
+// The map is sized at compile time. The default supports up to a 128x128 device.
+
+#ifndef kTileMapMaxBytes
+#define kTileMapMaxBytes 32
+#endif
+
+// Width of a tile in pixels (bytes of a page)
+#define kTileWidth 8
+
+// Clean tiles between two dirty runs that are merged into one transfer
+#define kTileMergeGap 1
+
+// Largest scale for textScaled()
+#define kTextScaleMax 4
+
+// Raster op function - writes the bits of src set in mask to the byte at dest
+typedef void (*rasterOPsFn)(uint8_t *dest, uint8_t src, uint8_t mask);
+
+/////////////////////////////////////////////////////////////////////////////
+// QwGrPageDevice
+//
+// A buffer graphics device that implements the drawing kernels for a page
+// organized (1 bit per pixel, 8 vertical pixels per byte) graphics buffer.
+//
+// Subclasses provide the buffer and implement the transfer of dirty data to
+// their device.
+
+class QwGrPageDevice : public QwGrBufferDevice
+{
+  public:
+    QwGrPageDevice()
+        : m_pBuffer{nullptr}, m_nPages{0}, m_rotation{0}, m_transposed{false}, m_pSpanPattern{nullptr},
+          m_tileStride{0}, m_pendingErase{false}, m_marqueeText{nullptr}
+    {
+    }
+    QwGrPageDevice(uint8_t width, uint8_t height) : QwGrPageDevice(0, 0, width, height){};
+
+    // call super class
+    QwGrPageDevice(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height)
+        : QwGrBufferDevice(x0, y0, width, height), m_pBuffer{nullptr}, m_nPages{0}, m_rotation{0},
+          m_transposed{false}, m_pSpanPattern{nullptr}, m_tileStride{0}, m_pendingErase{false},
+          m_marqueeText{nullptr}
+    {
+    }
+
+    // Public draw methods
+    void display(void); // send dirty areas of the graphics buffer to the device
+    void erase(void);
+
+    // The tiles of a page the next display() call sends - tile 0 is bit 0
+    uint32_t dirtyTiles(uint8_t page);
+
+    // Current rotation - 0, 1, 2, 3 for 0, 90, 180 and 270 degrees. Set by the device
+    // driver, see setRotation() of the driver.
+    uint8_t rotation(void)
+    {
+        return m_rotation;
+    }
+
+    // Draw a bitmap - only pixels set in the mask are written
+    void bitmapMasked(uint8_t x0, uint8_t y0, uint8_t *pBitmap, uint8_t *pMask, uint8_t bmp_width,
+                      uint8_t bmp_height);
+
+    // Copy a rect of the graphics buffer to a bitmap - width * (height+7)/8 bytes.
+    void saveRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t *pSave);
+
+    // Copy a rect of the graphics buffer - within this buffer, or from another page
+    // device - to x1, y1 using the current raster op. Overlapping rects are supported.
+    void copyRect(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t x1, uint8_t y1);
+    void copyRect(QwGrPageDevice &source, uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t x1,
+                  uint8_t y1);
+
+    // Draw text with the current font, scaled up 2, 3 or 4 times - each pixel of the
+    // font becomes a scale x scale block.
+    void textScaled(uint8_t x0, uint8_t y0, const char *text, uint8_t scale, uint8_t clr = 1);
+
+    // Draw text with a fixed width font known at compile time - the font resource class,
+    // for example text<QwFont8x16>(). The current font isn't changed.
+    using QwGrBufferDevice::text;
+    template <typename Font> void text(uint8_t x0, uint8_t y0, const char *text, uint8_t clr = 1);
+
+    // Write a run of bytes to a page and send it to the device now, outside of display().
+    // The graphics buffer, when present, is updated to match. With a 90 or 270 degree
+    // rotation, the run is sent by the next display().
+    void writeRun(uint8_t page, uint8_t x0, const uint8_t *pData, uint8_t nData);
+
+    // Marquee - text fed in at the right edge of a band of pages, one column per
+    // marqueeStep(). The text isn't copied. A null text stops the marquee.
+    bool setMarquee(const char *text, uint8_t page0);
+    bool marqueeStep(void);
+    bool marqueeActive(void)
+    {
+        return m_marqueeText != nullptr;
+    }
+
+  protected:
+    // Subclasses of this class define the specifics of the device, including size.
+    // Subclass needs to define the graphics buffer array - stack based - and pass in
+    void setBuffer(uint8_t *pBuffer);
+
+    // Set the number of pages in the buffer - returns false if the tile map can't
+    // cover the buffer
+    bool setPageCount(uint8_t nPages);
+
+    // clear the graphics buffer and set all tiles to clean
+    void clearBuffers(void);
+
+    // mark all tiles that contain displayed graphics as dirty - used to resend
+    void markDrawnDirty(void);
+
+    // mark the tiles that cover a column range of a page as dirty
+    void markDirty(uint8_t page, uint8_t x0, uint8_t x1);
+
+    // Swap the width and height of the graphics buffer - drawing for a device rotated
+    // 90 degrees. Tiles are turned as they're sent by display(). Clears the buffer.
+    bool setTransposed(bool bTransposed);
+
+    // Size of the device screen - the viewport before it's transposed
+    uint16_t panelWidth(void)
+    {
+        return m_transposed ? m_viewport.height : m_viewport.width;
+    }
+    uint16_t panelHeight(void)
+    {
+        return m_transposed ? m_viewport.width : m_viewport.height;
+    }
+
+    // Transfer a run of graphics buffer bytes to the device. Called by display()
+    // for each dirty run - page, starting column, data and number of bytes.
+    virtual void transferRun(uint8_t page, uint8_t x0, uint8_t *pData, uint8_t nData) = 0;
+
+    // Scroll pages page0 to page1 of the device screen buffer one column left - a
+    // marquee step. Returns false if the device can't, and the band is sent instead.
+    virtual bool scrollColumnLeft(uint8_t page0, uint8_t page1)
+    {
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Internal, fast draw routines - this are used in the overall
+    // draw interface (_QwIDraw) for this object/device/system.
+    //
+    // >> Pixels <<
+    void drawPixel(uint8_t x, uint8_t y, uint8_t clr);
+
+    // >> Fast Lines <<
+    void drawLineHorz(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
+    void drawLineVert(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
+
+    // fast rect fill
+    void drawRectFilled(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr);
+
+    // circle fill - the spans use the fill pattern
+    void drawCircleFilled(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t clr);
+
+    // >> Fast Bitmap <<
+    void drawBitmap(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
+                    uint8_t bmp_height);
+    // >> Block transfer <<
+    void drawBlock(const uint8_t *pSrc, uint8_t srcWidth, uint8_t srcHeight, uint8_t src_x, uint8_t src_y,
+                   uint8_t width, uint8_t height, uint8_t x0, uint8_t y0);
+
+    void drawBitmapMasked(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t *pMask,
+                          uint8_t bmp_width, uint8_t bmp_height);
+
+    // >> Row major (XBM, PBM) bitmaps <<
+    void drawBitmapRows(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
+                        uint8_t bmp_height, uint8_t format);
+
+    // >> Run length encoded bitmaps <<
+    void drawBitmapRLE(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
+                       uint8_t bmp_height);
+
+    // >> Text <<
+    void drawText(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t clr);
+
+    // Write the columns of a glyph - nRows rows of font data. Only the set bits of the
+    // glyph are written. Doesn't update the tile maps.
+    void drawGlyph(int16_t x0, uint16_t y0, const QwGlyph &theGlyph, uint8_t nRows, uint8_t clr);
+
+    // Text and glyphs drawn with each font pixel scaled to a scale x scale block
+    void drawTextScaled(int16_t x0, uint8_t y0, const char *text, uint16_t length, uint8_t scale, uint8_t clr);
+    void drawGlyphScaled(int16_t x0, uint16_t y0, const QwGlyph &theGlyph, uint8_t nRows, uint8_t scale,
+                         uint8_t clr);
+
+    // drawGlyph() for a glyph size known at compile time - PROGMEM glyph data
+    template <uint8_t Width, uint8_t NRows>
+    void drawGlyphFixed(int16_t x0, uint16_t y0, const uint8_t *pGlyph, uint16_t stride, uint8_t clr,
+                        rasterOPsFn curROP);
+
+    // the function of the current raster op
+    rasterOPsFn rasterOpFn(void);
+
+    /////////////////////////////////////////////////////////////////////////////
+    // instance vars
+
+    // Buffer variables
+    uint8_t *m_pBuffer; // Pointer to the graphics buffer
+    uint8_t m_nPages;   // number of pages for current device
+
+    uint8_t m_rotation; // 0 - 3, quarter turns
+    bool m_transposed;  // buffer width and height are swapped
+
+  private:
+    uint32_t tileRow(const uint8_t *pMap, uint8_t page);
+    void displayTransposed(void);
+    void markMarqueeSent(void);
+
+    // Pattern masked in by drawLineVert() - set during fills, nullptr for lines
+    const uint8_t *m_pSpanPattern;
+
+    // Tile maps - one bit per tile, m_tileStride bytes per page
+    uint8_t m_tileStride;
+    uint8_t m_tileDirty[kTileMapMaxBytes]; // tiles changed since the last display()
+    uint8_t m_tileErase[kTileMapMaxBytes]; // tiles with graphics sent to the device
+    bool m_pendingErase;
+
+    // Marquee state - the text, its font, the band of pages and the next text column
+    const char *m_marqueeText;
+    QwFont *m_marqueeFont;
+    uint8_t m_marqueePage0;
+    uint8_t m_marqueePage1;
+    uint16_t m_marqueeColumn;
+    uint16_t m_marqueeLength; // text width plus the screen width - the blank run-out
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// text<Font>()
+//
+// Draw text with a fixed width font known at compile time. The traits of the font
+// resource class (see QwFontTraits) make the glyph lookup and geometry constants, and
+// each glyph is written by a kernel built for the size of the font. Draws the same as
+// text() with the font set.
+//
+// Glyphs of a fixed width font only move right, so the walk stops at the clip rect.
+
+template <typename Font> void QwGrPageDevice::text(uint8_t x0, uint8_t y0, const char *text, uint8_t clr)
+{
+    typedef typename Font::traits traits;
+
+    if (!text || y0 > m_clipY1)
+        return;
+
+    const uint8_t *pData = Font::instance().data();
+    rasterOPsFn curROP = rasterOpFn();
+
+    int16_t x = x0; // pen position
+    int16_t xMin = m_clipX1 + 1, xMax = -1;
+    uint16_t code;
+
+    while (*text && x <= m_clipX1)
+    {
+        code = qwNextCode(text); // UTF-8
+
+        // characters that aren't in the font are blank
+        if (traits::contains(code) && x + traits::width() > m_clipX0)
+        {
+            drawGlyphFixed<traits::width(), traits::nRows()>(x, y0, pData + traits::glyphOffset(code),
+                                                             traits::mapWidth(), clr, curROP);
+            if (x < xMin)
+                xMin = x;
+            xMax = x + traits::width() - 1;
+        }
+        x += traits::advance();
+    }
+    if (xMin > xMax) // nothing drawn
+        return;
+
+    // dirty tiles - for the columns and pages drawn
+    if (xMin < m_clipX0)
+        xMin = m_clipX0;
+    if (xMax > m_clipX1)
+        xMax = m_clipX1;
+
+    uint16_t y1 = y0 + traits::nRows() * kByteNBits - 1;
+    if (y1 > m_clipY1)
+        y1 = m_clipY1;
+
+    for (uint8_t page = (y0 < m_clipY0 ? m_clipY0 : y0) / kByteNBits; page <= y1 / kByteNBits; page++)
+        markDirty(page, xMin, xMax);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// drawGlyphFixed()
+//
+// drawGlyph() with the glyph width and rows as constants - the row loop has a fixed
+// count for the compiler to unroll. The glyph data is in PROGMEM, stride bytes from
+// one row to the next.
+
+template <uint8_t Width, uint8_t NRows>
+void QwGrPageDevice::drawGlyphFixed(int16_t x0, uint16_t y0, const uint8_t *pGlyph, uint16_t stride, uint8_t clr,
+                                    rasterOPsFn curROP)
+{
+    // the columns of the glyph inside the clip rect - the caller makes sure some are
+    uint8_t col0 = x0 < m_clipX0 ? m_clipX0 - x0 : 0;
+    uint8_t col1 = x0 + Width - 1 > m_clipX1 ? m_clipX1 - x0 : Width - 1;
+
+    uint8_t shift = mod_byte(y0);
+    uint16_t y;
+    uint8_t clipMask, data, lo, hi, i;
+    uint8_t *pDest;
+
+    for (uint8_t row = 0; row < NRows; row++, pGlyph += stride)
+    {
+        // mask of the rows of this band inside the clip rect
+        y = y0 + row * kByteNBits;
+        if (y > m_clipY1)
+            break;
+
+        if (y + kByteNBits - 1 < m_clipY0)
+            continue;
+
+        clipMask = 0xFF;
+        if (y < m_clipY0)
+            clipMask <<= m_clipY0 - y;
+        if (y + kByteNBits - 1 > m_clipY1)
+            clipMask &= 0xFF >> (y + kByteNBits - 1 - m_clipY1);
+
+        pDest = m_pBuffer + (y0 / kByteNBits + row) * m_viewport.width + x0 + col0;
+
+        for (i = col0; i <= col1; i++, pDest++)
+        {
+            data = pgm_read_byte(pGlyph + i) & clipMask;
+            if (!data)
+                continue;
+
+            lo = data << shift;
+            if (lo)
+                curROP(pDest, clr ? lo : 0, lo);
+
+            // rest of the glyph byte goes in the next page
+            hi = shift ? data >> (kByteNBits - shift) : 0;
+            if (hi)
+                curROP(pDest + m_viewport.width, clr ? hi : 0, hi);
+        }
+    }
+}
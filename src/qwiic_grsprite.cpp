@@ -0,0 +1,508 @@
+
+// qwiic_grsprite.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Overview:
+//
+// Sprite layer implementation.
+//
+// Sprites are kept in a fixed array - the index of a sprite is its ID. A seperate order
+// array, sorted by z, defines the draw order. The graphics under each sprite are saved in
+// a section of the layer save buffer, sized by the sprite image.
+//
+// When a sprite changes, it's marked as changed. On update:
+//
+//      - The set of affected sprites is found - the changed sprites, plus any drawn sprite
+//        that overlaps the old or new area of an affected sprite.
+//      - The saved graphics of the affected sprites are restored - top sprite first, so
+//        the screen is peeled back in the reverse order it was built.
+//      - The affected, visible sprites are drawn bottom first - for each sprite, the
+//        graphics under the new location are saved, then the sprite is drawn.
+//
+// Sprites that don't overlap a change are left untouched, as are the device dirty tiles
+// for their area.
+
+#include "qwiic_grsprite.h"
+#include <string.h>
+
+// Sprite state flags
+#define kSpriteInUse 0x01
+#define kSpriteVisible 0x02
+#define kSpriteChanged 0x04
+#define kSpriteDrawn 0x08
+#define kSpriteRemoved 0x10
+#define kSpriteAffected 0x20
+
+// Rect intersection test - inclusive bounds
+#define rectsOverlap(_ax0_, _ay0_, _ax1_, _ay1_, _bx0_, _by0_, _bx1_, _by1_)                                       \
+    ((_ax0_) <= (_bx1_) && (_bx0_) <= (_ax1_) && (_ay0_) <= (_by1_) && (_by0_) <= (_ay1_))
+
+////////////////////////////////////////////////////////////////////////////////////
+// Constructor
+
+QwSpriteLayer::QwSpriteLayer() : m_nSprites{0}, m_sortPending{false}, m_saveUsed{0}, m_pending{false}
+{
+    for (int i = 0; i < kSpriteLayerMaxSprites; i++)
+        m_sprites[i].flags = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// sprite()
+//
+// Return the sprite for an ID, or nullptr if the ID isn't in use
+
+QwSprite *QwSpriteLayer::sprite(uint8_t id)
+{
+    if (id >= kSpriteLayerMaxSprites || !(m_sprites[id].flags & kSpriteInUse) ||
+        (m_sprites[id].flags & kSpriteRemoved))
+        return nullptr;
+
+    return &m_sprites[id];
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// sortOrder()
+//
+// Sort the draw order by z - insertion sort, which keeps the add order for sprites
+// with the same z.
+
+void QwSpriteLayer::sortOrder(void)
+{
+    uint8_t id;
+    int j;
+
+    for (int i = 1; i < m_nSprites; i++)
+    {
+        id = m_order[i];
+        for (j = i - 1; j >= 0 && m_sprites[m_order[j]].z > m_sprites[id].z; j--)
+            m_order[j + 1] = m_order[j];
+
+        m_order[j + 1] = id;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// addSprite()
+//
+// Find a free sprite, reserve the space to save the graphics under it and add it
+// to the draw order.
+
+uint8_t QwSpriteLayer::addSprite(uint8_t x, uint8_t y, uint8_t *pBitmap, uint8_t *pMask, uint8_t width,
+                                 uint8_t height, uint8_t z)
+{
+    if (m_nSprites >= kSpriteLayerMaxSprites || !pBitmap || !width || !height)
+        return kSpriteLayerNoSprite;
+
+    uint16_t saveSize = width * ((height + kByteNBits - 1) / kByteNBits);
+
+    if (m_saveUsed + saveSize > kSpriteLayerSaveBytes)
+        return kSpriteLayerNoSprite;
+
+    uint8_t id;
+    for (id = 0; id < kSpriteLayerMaxSprites; id++)
+        if (!(m_sprites[id].flags & kSpriteInUse))
+            break;
+
+    QwSprite &theSprite = m_sprites[id];
+
+    theSprite.flags = kSpriteInUse | kSpriteVisible | kSpriteChanged;
+    theSprite.z = z;
+    theSprite.x = x;
+    theSprite.y = y;
+    theSprite.width = width;
+    theSprite.height = height;
+    theSprite.pBitmap = pBitmap;
+    theSprite.pMask = pMask;
+    theSprite.saveOffset = m_saveUsed;
+    theSprite.saveSize = saveSize;
+
+    m_saveUsed += saveSize;
+
+    m_order[m_nSprites++] = id;
+    m_sortPending = true;
+
+    m_pending = true;
+
+    return id;
+}
+
+uint8_t QwSpriteLayer::addSprite(uint8_t x, uint8_t y, QwBitmap &bitmap, uint8_t z)
+{
+    return addSprite(x, y, (uint8_t *)bitmap.data(), nullptr, bitmap.width, bitmap.height, z);
+}
+
+uint8_t QwSpriteLayer::addSprite(uint8_t x, uint8_t y, QwBitmap &bitmap, QwBitmap &mask, uint8_t z)
+{
+    if (mask.width != bitmap.width || mask.height != bitmap.height)
+        return kSpriteLayerNoSprite;
+
+    return addSprite(x, y, (uint8_t *)bitmap.data(), (uint8_t *)mask.data(), bitmap.width, bitmap.height, z);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Change methods
+
+bool QwSpriteLayer::moveTo(uint8_t id, uint8_t x, uint8_t y)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite)
+        return false;
+
+    if (pSprite->x != x || pSprite->y != y)
+    {
+        pSprite->x = x;
+        pSprite->y = y;
+        pSprite->flags |= kSpriteChanged;
+        m_pending = true;
+    }
+    return true;
+}
+
+bool QwSpriteLayer::setZ(uint8_t id, uint8_t z)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite)
+        return false;
+
+    if (pSprite->z != z)
+    {
+        pSprite->z = z;
+        pSprite->flags |= kSpriteChanged;
+        m_sortPending = true;
+        m_pending = true;
+    }
+    return true;
+}
+
+bool QwSpriteLayer::setVisible(uint8_t id, bool visible)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite)
+        return false;
+
+    if (visible != ((pSprite->flags & kSpriteVisible) != 0))
+    {
+        pSprite->flags ^= kSpriteVisible;
+        pSprite->flags |= kSpriteChanged;
+        m_pending = true;
+    }
+    return true;
+}
+
+bool QwSpriteLayer::setBitmap(uint8_t id, uint8_t *pBitmap, uint8_t *pMask, uint8_t width, uint8_t height)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite || !pBitmap || !width || !height)
+        return false;
+
+    // must fit in the save space of the sprite
+    if (width * ((height + kByteNBits - 1) / kByteNBits) > pSprite->saveSize)
+        return false;
+
+    pSprite->pBitmap = pBitmap;
+    pSprite->pMask = pMask;
+    pSprite->width = width;
+    pSprite->height = height;
+    pSprite->flags |= kSpriteChanged;
+    m_pending = true;
+
+    return true;
+}
+
+bool QwSpriteLayer::setBitmap(uint8_t id, QwBitmap &bitmap)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite)
+        return false;
+
+    return setBitmap(id, (uint8_t *)bitmap.data(), pSprite->pMask, bitmap.width, bitmap.height);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// remove()
+//
+// If the sprite is on screen, it's removed on the next update, after the graphics
+// under it are restored.
+
+bool QwSpriteLayer::remove(uint8_t id)
+{
+    QwSprite *pSprite = sprite(id);
+    if (!pSprite)
+        return false;
+
+    if (!(pSprite->flags & kSpriteDrawn))
+    {
+        freeSave(id);
+        return true;
+    }
+
+    pSprite->flags = (pSprite->flags & ~kSpriteVisible) | kSpriteRemoved | kSpriteChanged;
+    m_pending = true;
+
+    return true;
+}
+
+void QwSpriteLayer::clear(void)
+{
+    for (int i = 0; i < kSpriteLayerMaxSprites; i++)
+        remove(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// invalidate()
+//
+// The graphics under the sprites are no longer valid - the buffer was erased or
+// redrawn. Forget what was drawn and draw every visible sprite on the next update.
+
+void QwSpriteLayer::invalidate(void)
+{
+    for (int i = 0; i < kSpriteLayerMaxSprites; i++)
+    {
+        QwSprite &theSprite = m_sprites[i];
+
+        if (!(theSprite.flags & kSpriteInUse))
+            continue;
+
+        if (theSprite.flags & kSpriteRemoved)
+        {
+            theSprite.flags &= ~kSpriteDrawn;
+            freeSave(i);
+            continue;
+        }
+        theSprite.flags = (theSprite.flags & ~kSpriteDrawn) | kSpriteChanged;
+    }
+    m_pending = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// freeSave()
+//
+// Release a sprite - its save space is returned by moving down the save space of
+// the sprites after it.
+
+void QwSpriteLayer::freeSave(uint8_t id)
+{
+    QwSprite &theSprite = m_sprites[id];
+
+    uint16_t end = theSprite.saveOffset + theSprite.saveSize;
+
+    memmove(m_save + theSprite.saveOffset, m_save + end, m_saveUsed - end);
+    m_saveUsed -= theSprite.saveSize;
+
+    for (int i = 0; i < kSpriteLayerMaxSprites; i++)
+        if ((m_sprites[i].flags & kSpriteInUse) && m_sprites[i].saveOffset >= end)
+            m_sprites[i].saveOffset -= theSprite.saveSize;
+
+    theSprite.flags = 0;
+
+    // remove from the draw order
+    uint8_t j = 0;
+    for (uint8_t i = 0; i < m_nSprites; i++)
+        if (m_order[i] != id)
+            m_order[j++] = m_order[i];
+
+    m_nSprites = j;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// overlaps()
+//
+// Does any area of a sprite - where it's drawn, or where it will be drawn - overlap
+// any area of another sprite?
+
+bool QwSpriteLayer::overlaps(QwSprite &theSprite, QwSprite &other)
+{
+    uint16_t rects[4][4];
+    uint8_t nA = 0, nB;
+
+    // the areas of the sprite
+    if (theSprite.flags & kSpriteDrawn)
+    {
+        rects[nA][0] = theSprite.drawnX;
+        rects[nA][1] = theSprite.drawnY;
+        rects[nA][2] = theSprite.drawnX + theSprite.drawnWidth - 1;
+        rects[nA][3] = theSprite.drawnY + theSprite.drawnHeight - 1;
+        nA++;
+    }
+    if (theSprite.flags & kSpriteVisible)
+    {
+        rects[nA][0] = theSprite.x;
+        rects[nA][1] = theSprite.y;
+        rects[nA][2] = theSprite.x + theSprite.width - 1;
+        rects[nA][3] = theSprite.y + theSprite.height - 1;
+        nA++;
+    }
+
+    // the areas of the other sprite
+    nB = nA;
+    if (other.flags & kSpriteDrawn)
+    {
+        rects[nB][0] = other.drawnX;
+        rects[nB][1] = other.drawnY;
+        rects[nB][2] = other.drawnX + other.drawnWidth - 1;
+        rects[nB][3] = other.drawnY + other.drawnHeight - 1;
+        nB++;
+    }
+    if (other.flags & kSpriteVisible)
+    {
+        rects[nB][0] = other.x;
+        rects[nB][1] = other.y;
+        rects[nB][2] = other.x + other.width - 1;
+        rects[nB][3] = other.y + other.height - 1;
+        nB++;
+    }
+
+    for (uint8_t a = 0; a < nA; a++)
+        for (uint8_t b = nA; b < nB; b++)
+            if (rectsOverlap(rects[a][0], rects[a][1], rects[a][2], rects[a][3], rects[b][0], rects[b][1],
+                             rects[b][2], rects[b][3]))
+                return true;
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// update()
+//
+// Restore and redraw the sprites affected by changes. See overview above.
+
+void QwSpriteLayer::update(QwGrPageDevice &device)
+{
+    if (!m_pending)
+        return;
+
+    int i, j;
+    bool bAdded;
+
+    // Find the affected sprites - start with the changed sprites, then add any sprite
+    // that overlaps an affected sprite, until nothing is added.
+    for (i = 0; i < m_nSprites; i++)
+    {
+        QwSprite &theSprite = m_sprites[m_order[i]];
+
+        if (theSprite.flags & kSpriteChanged)
+            theSprite.flags |= kSpriteAffected;
+    }
+    do
+    {
+        bAdded = false;
+        for (i = 0; i < m_nSprites; i++)
+        {
+            QwSprite &theSprite = m_sprites[m_order[i]];
+
+            if (theSprite.flags & kSpriteAffected)
+                continue;
+
+            for (j = 0; j < m_nSprites; j++)
+            {
+                QwSprite &other = m_sprites[m_order[j]];
+
+                if ((other.flags & kSpriteAffected) && overlaps(theSprite, other))
+                {
+                    theSprite.flags |= kSpriteAffected;
+                    bAdded = true;
+                    break;
+                }
+            }
+        }
+    } while (bAdded);
+
+    // Sprites draw to the full screen with the copy op - save the current device settings
+    QwRect clip = device.clipRect();
+    grRasterOp_t rop = device.rasterOp();
+
+    device.clearClipRect();
+    device.setRasterOp(grROPCopy);
+
+    // Restore the graphics under the affected sprites - top sprite first
+    for (i = m_nSprites - 1; i >= 0; i--)
+    {
+        QwSprite &theSprite = m_sprites[m_order[i]];
+
+        if ((theSprite.flags & (kSpriteAffected | kSpriteDrawn)) != (kSpriteAffected | kSpriteDrawn))
+            continue;
+
+        device.bitmap(theSprite.drawnX, theSprite.drawnY, m_save + theSprite.saveOffset, theSprite.drawnWidth,
+                      theSprite.drawnHeight);
+        theSprite.flags &= ~kSpriteDrawn;
+    }
+
+    // The saves are restored - now sort in any z changes for the redraw
+    if (m_sortPending)
+    {
+        sortOrder();
+        m_sortPending = false;
+    }
+
+    // Release removed sprites - the order shrinks, so walk down
+    for (i = m_nSprites - 1; i >= 0; i--)
+        if (m_sprites[m_order[i]].flags & kSpriteRemoved)
+            freeSave(m_order[i]);
+
+    // Save the graphics under, and draw, the affected sprites - bottom sprite first
+    for (i = 0; i < m_nSprites; i++)
+    {
+        QwSprite &theSprite = m_sprites[m_order[i]];
+
+        if ((theSprite.flags & (kSpriteAffected | kSpriteVisible)) == (kSpriteAffected | kSpriteVisible))
+        {
+            device.saveRect(theSprite.x, theSprite.y, theSprite.width, theSprite.height,
+                            m_save + theSprite.saveOffset);
+            device.bitmapMasked(theSprite.x, theSprite.y, theSprite.pBitmap, theSprite.pMask, theSprite.width,
+                                theSprite.height);
+
+            theSprite.drawnX = theSprite.x;
+            theSprite.drawnY = theSprite.y;
+            theSprite.drawnWidth = theSprite.width;
+            theSprite.drawnHeight = theSprite.height;
+            theSprite.flags |= kSpriteDrawn;
+        }
+        theSprite.flags &= ~(kSpriteAffected | kSpriteChanged);
+    }
+
+    // restore the device settings
+    device.setClipRect(clip.x, clip.y, clip.width, clip.height);
+    device.setRasterOp(rop);
+
+    m_pending = false;
+}
@@ -0,0 +1,160 @@
+
+// qwiic_grsprite.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//
+// Sprite layer with save-under.
+//
+// A sprite is a bitmap, with an optional mask, drawn at a position with a z-order. Before
+// a sprite is drawn, the graphics under it are saved. When the sprite moves, changes or
+// is hidden, the saved graphics are restored and the sprite is drawn at its new location.
+//
+// Only the area covered by the old and new positions of a changed sprite - and any sprites
+// overlapping that area - is touched, so the next display() call only transfers that region.
+//
+// Draw the background before calling update(). If the graphics under the sprites are erased
+// or redrawn, call invalidate() so the saved graphics are discarded.
+
+#pragma once
+
+#include "qwiic_grpage.h"
+
+// The number of sprites a layer can hold. Can be overridden at build time.
+#ifndef kSpriteLayerMaxSprites
+#define kSpriteLayerMaxSprites 8
+#endif
+
+// Bytes available to hold the graphics under the sprites - a sprite uses
+// width * (height + 7)/8 bytes. Can be overridden at build time.
+#ifndef kSpriteLayerSaveBytes
+#define kSpriteLayerSaveBytes 256
+#endif
+
+// ID returned when a sprite can't be added
+#define kSpriteLayerNoSprite 0xFF
+
+// A sprite record
+struct QwSprite
+{
+    uint8_t flags; // state flags - in use, visible, changed, drawn
+    uint8_t z;     // z-order - higher values are drawn on top
+
+    // Position and image
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;
+    uint8_t height;
+    uint8_t *pBitmap;
+    uint8_t *pMask; // nullptr - draw all pixels of the bitmap
+
+    // Where the sprite was last drawn - the saved graphics cover this area
+    uint8_t drawnX;
+    uint8_t drawnY;
+    uint8_t drawnWidth;
+    uint8_t drawnHeight;
+
+    // Location of the saved graphics in the layer save buffer
+    uint16_t saveOffset;
+    uint16_t saveSize;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// QwSpriteLayer
+//
+
+class QwSpriteLayer
+{
+  public:
+    QwSpriteLayer();
+
+    // Add sprites - returns the ID of the new sprite, or kSpriteLayerNoSprite if the layer
+    // is full or out of save space.
+    //
+    // Note: bitmaps aren't copied - they must stay valid while in the layer.
+    uint8_t addSprite(uint8_t x, uint8_t y, QwBitmap &bitmap, uint8_t z = 0);
+    uint8_t addSprite(uint8_t x, uint8_t y, QwBitmap &bitmap, QwBitmap &mask, uint8_t z = 0);
+    uint8_t addSprite(uint8_t x, uint8_t y, uint8_t *pBitmap, uint8_t *pMask, uint8_t width, uint8_t height,
+                      uint8_t z = 0);
+
+    // Change sprites
+    bool moveTo(uint8_t id, uint8_t x, uint8_t y);
+    bool setZ(uint8_t id, uint8_t z);
+    bool setVisible(uint8_t id, bool visible);
+
+    // Change the image of a sprite - for animation. The new image can't be larger
+    // than the image the sprite was added with.
+    bool setBitmap(uint8_t id, QwBitmap &bitmap);
+    bool setBitmap(uint8_t id, uint8_t *pBitmap, uint8_t *pMask, uint8_t width, uint8_t height);
+
+    // Remove sprites - the graphics under them are restored on the next update
+    bool remove(uint8_t id);
+    void clear(void);
+
+    // The graphics under the sprites changed (erase, redraw) - discard the saved
+    // graphics and draw all sprites on the next update
+    void invalidate(void);
+
+    // Restore the graphics under changed sprites and draw them at their new locations.
+    // The device clip rect and raster op are preserved.
+    void update(QwGrPageDevice &device);
+
+  private:
+    QwSprite *sprite(uint8_t id);
+    void sortOrder(void);
+    void freeSave(uint8_t id);
+    bool overlaps(QwSprite &theSprite, QwSprite &other);
+
+    QwSprite m_sprites[kSpriteLayerMaxSprites];
+
+    // draw order - ids, sorted by z. A changed z is sorted in by update(), once the
+    // sprites are restored in the order they were drawn.
+    uint8_t m_order[kSpriteLayerMaxSprites];
+    uint8_t m_nSprites;
+    bool m_sortPending;
+
+    // graphics saved under the sprites
+    uint8_t m_save[kSpriteLayerSaveBytes];
+    uint16_t m_saveUsed;
+
+    bool m_pending; // anything to do?
+};
@@ -49,7 +49,7 @@
 
 #pragma once
 
-#include "qwiic_grbuffer.h"
+#include "qwiic_grpage.h"
 #include "qwiic_i2c.h"
 #include "res/qwiic_resdef.h"
 #include "qwiic_grcommon.h"
@@ -73,12 +73,8 @@
 /////////////////////////////////////////////////////////////////////////////
 //
 // The memory/back buffer of the SSD1306 is based on the concept of pages -
-// each page is a stream of bytes, and defined as follows:
-//
-//      - X pixel position is an offset in a byte array
-//      - Y pixel position is a bit in a byte, so a page can have 8 Y locations
-//
-// A pixel value of 1, turn on the corresponding pixel, 0 turns it off.
+// each page is a stream of bytes. See qwiic_grpage.h for details on the buffer
+// layout and how dirty regions are tracked.
 //
 // The device has different data transfer modes - see the data sheet - mostly
 // outline how received a recieved byte is placed in the device framebuffer and the
@@ -90,36 +86,15 @@
 //       position
 //     - If the end of the page is reached, the next entry location is the start of that page
 //
-// >> Implementation <<
-//
-// This implementation uses the concept of "dirty rects" at the page level to minimize data
-// transfers to the device. The min and max x locations set for each page is recorded as
-// graphics are draw to the graphics buffer. When the transfering the display buffer to
-// the devices screen buffer, the following takes place:
-//
-//      For each page:
-//          - if page is dirty
-//              - Set the screen buffer current location to this page, xmin dirty value
-//              - Write buffer bytes to the device - starting at xmin for the page, ending at xmax
-//              - Mark the buffer as "clean"
-//
-//
-// Define variables to manage page state
+// Define the number of pages on the device
 
 #define kMaxPageNumber 8
 
-// moved to common for now...
-// typedef struct
-// {
-//     int16_t xmin;
-//     int16_t xmax;
-// } pageState_t;
-
 /////////////////////////////////////////////////////////////////////////////
 // QwGrSSD1306
 // A buffer graphics device to support the SSD1306 graphics hardware
 
-class QwGrSSD1306 : public QwGrBufferDevice
+class QwGrSSD1306 : public QwGrPageDevice
 {
   private:
     void setupDefaults(void);
@@ -132,15 +107,11 @@ class QwGrSSD1306 : public QwGrBufferDevice
     QwGrSSD1306(uint8_t width, uint8_t height) : QwGrSSD1306(0, 0, width, height){};
 
     // call super class
-    QwGrSSD1306(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height) : QwGrBufferDevice(x0, y0, width, height)
+    QwGrSSD1306(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height) : QwGrPageDevice(x0, y0, width, height)
     {
         setupDefaults();
     };
 
-    // Public draw methods
-    void display(void); // send graphics buffer to the devices screen buffer
-    void erase(void);
-
     // Device setup
     virtual bool init(void);
 
@@ -162,19 +133,19 @@ class QwGrSSD1306 : public QwGrBufferDevice
     // default address of the device - expect the sub to fill in.
     uint8_t default_address;
 
-    void setRasterOp(grRasterOp_t rop)
-    {
-        m_rop = rop;
-    }
-
-    grRasterOp_t rasterOp(void)
-    {
-        return m_rop;
-    }
     // screen control
     void invert(bool);
     void flipVert(bool);
     void flipHorz(bool);
+    bool setStartLine(uint8_t line);
+    bool setRotation(uint8_t rotation);
+
+    // draw to all rows of the screen buffer - the display shows a window, see setStartLine()
+    bool setVirtualCanvas(uint8_t *pBuffer);
+    bool virtualCanvas(void)
+    {
+        return m_screenHeight != 0;
+    }
 
     // screen scrolling
     void stopScroll(void);
@@ -183,27 +154,11 @@ class QwGrSSD1306 : public QwGrBufferDevice
     void displayPower(bool enable = true);
 
   protected:
-    // Subclasses of this class define the specifics of the device, including size.
-    // Subclass needs to define the graphics buffer array - stack based - and pass in
-    void setBuffer(uint8_t *pBuffer);
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Internal, fast draw routines - this are used in the overall
-    // draw interface (_QwIDraw) for this object/device/system.
-    //
-    // >> Pixels <<
-    void drawPixel(uint8_t x, uint8_t y, uint8_t clr);
-
-    // >> Fast Lines <<
-    void drawLineHorz(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
-    void drawLineVert(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t clr);
+    // send a run of graphics buffer bytes to the device - called by display()
+    void transferRun(uint8_t page, uint8_t x0, uint8_t *pData, uint8_t nData);
 
-    // fast rect fill
-    void drawRectFilled(uint8_t x0, uint8_t y0, uint8_t width, uint8_t height, uint8_t clr);
-
-    // >> Fast Bitmap <<
-    void drawBitmap(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t *pBitmap, uint8_t bmp_width,
-                    uint8_t bmp_height);
+    // scroll a band of pages of the screen buffer one column left - for the marquee
+    bool scrollColumnLeft(uint8_t page0, uint8_t page1);
 
     ///////////////////////////////////////////////////////////////////////////
     // configuration methods for sub-classes. Settings unique to a device
@@ -219,6 +174,12 @@ class QwGrSSD1306 : public QwGrBufferDevice
     void resendGraphics(void);
     void setupOLEDDevice(bool clearDisplay = true);
 
+    // rows of the display - the panel height, also with a virtual canvas
+    uint16_t screenRows(void)
+    {
+        return m_screenHeight ? m_screenHeight : panelHeight();
+    }
+
     // device communication methods
     void sendDevCommand(uint8_t command);
     void sendDevCommand(uint8_t command, uint8_t value);
@@ -228,16 +189,8 @@ class QwGrSSD1306 : public QwGrBufferDevice
     /////////////////////////////////////////////////////////////////////////////
     // instance vars
 
-    // Buffer variables
-    uint8_t *m_pBuffer;                      // Pointer to the graphics buffer
-    uint8_t m_nPages;                        // number of pages for current device
-    pageState_t m_pageState[kMaxPageNumber]; // page state descriptors
-    pageState_t m_pageErase[kMaxPageNumber]; // keep track of erase boundaries
-    bool m_pendingErase;
-
     // display variables
-    uint8_t m_color;    // current color (really 0 or 1)
-    grRasterOp_t m_rop; // current raster operation code
+    uint8_t m_color; // current color (really 0 or 1)
 
     // I2C  things
     QwI2C *m_i2cBus;      // pointer to our i2c bus object
@@ -250,4 +203,8 @@ class QwGrSSD1306 : public QwGrBufferDevice
     uint8_t m_initContrast;
 
     bool m_isInitialized; // general init flag
+
+    // virtual canvas - the screen height and graphics buffer while a canvas is set
+    uint8_t m_screenHeight;
+    uint8_t *m_pScreenBuffer;
 };
@@ -0,0 +1,209 @@
+
+// qwiic_grtextgrid.cpp
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Overview:
+//
+// Text grid implementation.
+//
+// The cells are kept row by row in a character array, with a matching dirty bit array. A
+// cell is rasterized a page at a time into a run buffer: the glyph columns for the page are
+// copied in, with columns outside of the cell cut. Blank columns are zero, so a cell always
+// replaces what was on the display.
+
+#include "qwiic_grtextgrid.h"
+#include <string.h>
+
+#define cellIndex(_col_, _row_) ((_row_)*m_columns + (_col_))
+#define cellDirty(_index_) (m_dirty[(_index_) / kByteNBits] & byte_bits[mod_byte((_index_))])
+#define setCellDirty(_index_) (m_dirty[(_index_) / kByteNBits] |= byte_bits[mod_byte((_index_))])
+#define clearCellDirty(_index_) (m_dirty[(_index_) / kByteNBits] &= ~byte_bits[mod_byte((_index_))])
+
+////////////////////////////////////////////////////////////////////////////////////
+
+QwTextGrid::QwTextGrid()
+    : m_pFont{nullptr}, m_columns{0}, m_rows{0}, m_x0{0}, m_page0{0}, m_cellWidth{kTextGridCellWidth},
+      m_cellPages{1}, m_pending{false}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// begin()
+
+bool QwTextGrid::begin(QwFont &theFont, uint8_t columns, uint8_t rows, uint8_t x0, uint8_t page0, uint8_t cellWidth)
+{
+    if (!columns || !rows || columns * rows > kTextGridMaxCells || !cellWidth || cellWidth > kTextGridMaxRun)
+        return false;
+
+    m_pFont = &theFont;
+    m_columns = columns;
+    m_rows = rows;
+    m_x0 = x0;
+    m_page0 = page0;
+    m_cellWidth = cellWidth;
+
+    // same number of rows text() draws for the font
+    m_cellPages = theFont.height / kByteNBits;
+    if (!m_cellPages)
+        m_cellPages = 1;
+
+    clear();
+    invalidate();
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Cell access
+
+void QwTextGrid::setChar(uint8_t column, uint8_t row, char theChar)
+{
+    if (column >= m_columns || row >= m_rows)
+        return;
+
+    uint16_t index = cellIndex(column, row);
+    if (m_cells[index] == theChar)
+        return;
+
+    m_cells[index] = theChar;
+    setCellDirty(index);
+    m_pending = true;
+}
+
+char QwTextGrid::getChar(uint8_t column, uint8_t row)
+{
+    return column < m_columns && row < m_rows ? m_cells[cellIndex(column, row)] : 0;
+}
+
+uint8_t QwTextGrid::print(uint8_t column, uint8_t row, const char *text)
+{
+    if (!text || row >= m_rows)
+        return 0;
+
+    uint8_t n = 0;
+    for (; column < m_columns && *text; column++, text++, n++)
+        setChar(column, row, *text);
+
+    return n;
+}
+
+void QwTextGrid::clear(void)
+{
+    for (uint16_t i = 0; i < m_columns * m_rows; i++)
+        setChar(i % m_columns, i / m_columns, ' ');
+}
+
+void QwTextGrid::invalidate(void)
+{
+    memset(m_dirty, 0xFF, sizeof(m_dirty));
+    m_pending = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// rasterize()
+//
+// Build one page of a cell - m_cellWidth bytes at pDest.
+
+void QwTextGrid::rasterize(uint8_t column, uint8_t row, uint8_t page, uint8_t *pDest)
+{
+    memset(pDest, 0, m_cellWidth);
+
+    QwGlyph theGlyph;
+    if (!m_pFont->glyph((uint8_t)m_cells[cellIndex(column, row)], theGlyph) || !theGlyph.pData)
+        return; // blank
+
+    const uint8_t *pGlyph = theGlyph.pData + page * theGlyph.stride;
+    int16_t x = theGlyph.xOffset;
+
+    for (uint8_t i = 0; i < theGlyph.width; i++, x++)
+    {
+        if (x >= 0 && x < m_cellWidth)
+            pDest[x] = theGlyph.inRAM ? pGlyph[i] : pgm_read_byte(pGlyph + i);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// update()
+//
+// Send the changed cells. Each run of changed cells on a row - up to the run buffer
+// size - is rasterized and sent a page at a time.
+
+void QwTextGrid::update(QwGrPageDevice &device)
+{
+    if (!m_pending || !m_pFont)
+        return;
+
+    uint8_t run[kTextGridMaxRun];
+    uint8_t maxCells = kTextGridMaxRun / m_cellWidth;
+    uint8_t column, nCells, i, page;
+    uint16_t index, x;
+
+    for (uint8_t row = 0; row < m_rows; row++)
+    {
+        for (column = 0; column < m_columns; column += nCells)
+        {
+            index = cellIndex(column, row);
+            if (!cellDirty(index))
+            {
+                nCells = 1;
+                continue;
+            }
+
+            // the run of changed cells starting here
+            for (nCells = 1; nCells < maxCells && column + nCells < m_columns && cellDirty(index + nCells); nCells++)
+                ;
+
+            x = m_x0 + column * m_cellWidth;
+            for (page = 0; page < m_cellPages && x <= 0xFF; page++)
+            {
+                for (i = 0; i < nCells; i++)
+                    rasterize(column + i, row, page, run + i * m_cellWidth);
+
+                device.writeRun(m_page0 + row * m_cellPages + page, x, run, nCells * m_cellWidth);
+            }
+            for (i = 0; i < nCells; i++)
+                clearCellDirty(index + i);
+        }
+    }
+    m_pending = false;
+}
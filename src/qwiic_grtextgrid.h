@@ -0,0 +1,135 @@
+
+// qwiic_grtextgrid.h
+//
+// This is a library written for SparkFun Qwiic OLED boards that use the SSD1306.
+//
+// SparkFun sells these at its website: www.sparkfun.com
+//
+// Do you like this library? Help support SparkFun. Buy a board!
+//
+//   Micro OLED             https://www.sparkfun.com/products/14532
+//   Transparent OLED       https://www.sparkfun.com/products/15173
+//   "Narrow" OLED          https://www.sparkfun.com/products/17153
+//
+//
+// This library configures and draws graphics to OLED boards that use the
+// SSD1306 display hardware. The library only supports I2C.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// Documentation:
+//     https://sparkfun.github.io/SparkFun_Qwiic_OLED_Arduino_Library/
+//
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+//
+// Text grid - a character cell text mode.
+//
+// A text grid is an array of character cells, placed on page boundaries of the display. Each
+// cell holds a character code, and has a dirty bit that is set when the character changes.
+// On update, only the changed cells are rasterized - with the grid font - and sent straight
+// to the device, a page run of cell width bytes for each page of the cell. Adjacent changed
+// cells on a row are sent as one run.
+//
+// The grid doesn't draw into the graphics buffer, so a text only screen costs the cell array
+// rather than a full erase(), text() and display() cycle. If the device has a graphics buffer,
+// it's kept in step with the cells sent.
+//
+// For example, a 128x64 display with the 5x7 font is a grid of 16 x 8 cells, 8 x 8 pixels each.
+
+#pragma once
+
+#include "qwiic_grpage.h"
+
+// The number of cells a grid can hold. Can be overridden at build time.
+#ifndef kTextGridMaxCells
+#define kTextGridMaxCells 256
+#endif
+
+// Default width of a cell in pixels
+#define kTextGridCellWidth 8
+
+// Largest run sent in one transfer - bytes
+#define kTextGridMaxRun 64
+
+///////////////////////////////////////////////////////////////////////////////////////////
+// QwTextGrid
+//
+
+class QwTextGrid
+{
+  public:
+    QwTextGrid();
+
+    // Set the font and layout of the grid - columns x rows cells, with the upper left cell at
+    // column x0 of page page0. A cell is cellWidth pixels wide and the font height, rounded
+    // up to pages, tall. Returns false if the grid has more than kTextGridMaxCells cells.
+    //
+    // The grid is cleared to spaces and every cell is sent on the next update.
+    bool begin(QwFont &theFont, uint8_t columns, uint8_t rows, uint8_t x0 = 0, uint8_t page0 = 0,
+               uint8_t cellWidth = kTextGridCellWidth);
+
+    uint8_t columns(void)
+    {
+        return m_columns;
+    }
+    uint8_t rows(void)
+    {
+        return m_rows;
+    }
+
+    // Set the character of a cell - the cell is only marked changed if the character is new
+    void setChar(uint8_t column, uint8_t row, char theChar);
+    char getChar(uint8_t column, uint8_t row);
+
+    // Write text into a row, starting at column - the text is cut at the end of the row.
+    // Returns the number of cells written.
+    uint8_t print(uint8_t column, uint8_t row, const char *text);
+
+    // Set all cells to spaces
+    void clear(void);
+
+    // Send every cell on the next update - for example after the device is erased
+    void invalidate(void);
+
+    // Rasterize the changed cells and send them to the device - with a 90 or 270 degree
+    // rotation, they're sent by the next display()
+    void update(QwGrPageDevice &device);
+
+  private:
+    void rasterize(uint8_t column, uint8_t row, uint8_t page, uint8_t *pDest);
+
+    QwFont *m_pFont;
+
+    uint8_t m_columns;
+    uint8_t m_rows;
+    uint8_t m_x0;
+    uint8_t m_page0;
+    uint8_t m_cellWidth;
+    uint8_t m_cellPages; // pages per cell
+
+    char m_cells[kTextGridMaxCells];
+    uint8_t m_dirty[(kTextGridMaxCells + 7) / 8]; // one bit per cell
+
+    bool m_pending; // anything to send?
+};
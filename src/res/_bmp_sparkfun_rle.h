@@ -0,0 +1,25 @@
+// _bmp_sparkfun_rle.h
+//
+// Run length encoded bitmap - created by tools/qwbitmap_rle.py from _bmp_sparkfun.h
+//
+// 98 bytes, 384 bytes uncompressed
+
+#pragma once
+
+#define BMP_SPARKFUN_RLE_WIDTH  64
+#define BMP_SPARKFUN_RLE_HEIGHT 48
+
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t bmp_sparkfun_rle_data[] = {
+#else
+	static const uint8_t bmp_sparkfun_rle_data[] PROGMEM = {
+#endif
+    0x96, 0x00, 0x03, 0xE0, 0xF8, 0xFC, 0xFE, 0x85, 0xFF, 0x07, 0x0F, 0x07, 0x07, 0x06, 0x06, 0x00,
+    0x80, 0x80, 0xA5, 0x00, 0x84, 0x80, 0x04, 0x81, 0x07, 0x0F, 0x3F, 0x3F, 0x85, 0xFF, 0x80, 0xFE,
+    0x81, 0xFC, 0x00, 0xFE, 0x81, 0xFF, 0x02, 0xFC, 0xF8, 0xE0, 0x9D, 0x00, 0x01, 0xFC, 0xFE, 0x84,
+    0xFF, 0x00, 0xF1, 0x83, 0xE0, 0x01, 0xF0, 0xFD, 0x8F, 0xFF, 0x9D, 0x00, 0x9A, 0xFF, 0x04, 0x7F,
+    0x3F, 0x1F, 0x07, 0x01, 0x9D, 0x00, 0x87, 0xFF, 0x03, 0x7F, 0x3F, 0x1F, 0x1F, 0x86, 0x0F, 0x81,
+    0x07, 0x80, 0x03, 0x00, 0x01, 0xA3, 0x00, 0x07, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01,
+    0xA7, 0x00,
+};
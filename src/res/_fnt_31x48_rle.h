@@ -0,0 +1,315 @@
+/****************************************************************************** 
+fontlargeletter.h
+Definition for large letter only font
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Created by:
+DaAwesomeP
+August 13, 2015
+https://github.com/DaAwesomeP/SparkFun_Micro_OLED_Arduino_Library/
+
+******************************************************************************/
+
+#pragma once
+
+// _fnt_31x48.h packed - created by tools/qwfont_pack.py
+//
+// 3701 bytes, 10788 bytes unpacked
+
+// Define the font attributes
+#define FONT_31X48_RLE_WIDTH        31
+#define FONT_31X48_RLE_HEIGHT       48
+#define FONT_31X48_RLE_START        65
+#define FONT_31X48_RLE_NCHAR        58
+#define FONT_31X48_RLE_GLYPH_BYTES  180
+#define FONT_31X48_RLE_NAME         "31 x 48"
+
+// Glyph records and packed glyph data - see QwPackedFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font31x48_rle_data[] = {
+#else
+	static const uint8_t font31x48_rle_data[] PROGMEM = {
+#endif
+	// glyph records - offset, width, x offset, advance
+	0x00, 0x00, 30, 0, 31, // 'A'
+	0x50, 0x00, 24, 4, 31, // 'B'
+	0x8F, 0x00, 25, 3, 31, // 'C'
+	0xE5, 0x00, 23, 4, 31, // 'D'
+	0x22, 0x01, 23, 4, 31, // 'E'
+	0x3A, 0x01, 21, 5, 31, // 'F'
+	0x4E, 0x01, 24, 3, 31, // 'G'
+	0xA0, 0x01, 22, 4, 31, // 'H'
+	0xBC, 0x01, 20, 5, 31, // 'I'
+	0xD4, 0x01, 20, 4, 31, // 'J'
+	0x05, 0x02, 26, 4, 31, // 'K'
+	0x59, 0x02, 21, 6, 31, // 'L'
+	0x6D, 0x02, 24, 3, 31, // 'M'
+	0xAE, 0x02, 22, 4, 31, // 'N'
+	0xE9, 0x02, 25, 2, 31, // 'O'
+	0x43, 0x03, 23, 4, 31, // 'P'
+	0x71, 0x03, 26, 2, 31, // 'Q'
+	0xDA, 0x03, 24, 4, 31, // 'R'
+	0x22, 0x04, 26, 2, 31, // 'S'
+	0x8A, 0x04, 26, 2, 31, // 'T'
+	0xA2, 0x04, 23, 3, 31, // 'U'
+	0xD8, 0x04, 30, 0, 31, // 'V'
+	0x2E, 0x05, 30, 0, 31, // 'W'
+	0x93, 0x05, 28, 1, 31, // 'X'
+	0xFA, 0x05, 28, 1, 31, // 'Y'
+	0x3F, 0x06, 26, 2, 31, // 'Z'
+	0x76, 0x06, 13, 10, 31, // '['
+	0x8E, 0x06, 24, 3, 31, // 0x5C
+	0xC4, 0x06, 13, 7, 31, // ']'
+	0xDC, 0x06, 23, 3, 31, // '^'
+	0x15, 0x07, 30, 0, 31, // '_'
+	0x1B, 0x07, 10, 10, 31, // '`'
+	0x28, 0x07, 25, 3, 31, // 'a'
+	0x78, 0x07, 23, 4, 31, // 'b'
+	0xC3, 0x07, 23, 3, 31, // 'c'
+	0x07, 0x08, 23, 3, 31, // 'd'
+	0x53, 0x08, 24, 3, 31, // 'e'
+	0x9B, 0x08, 24, 3, 31, // 'f'
+	0xBB, 0x08, 23, 3, 31, // 'g'
+	0x14, 0x09, 21, 5, 31, // 'h'
+	0x3F, 0x09, 24, 3, 31, // 'i'
+	0x5B, 0x09, 17, 3, 31, // 'j'
+	0x7D, 0x09, 21, 6, 31, // 'k'
+	0xC1, 0x09, 24, 3, 31, // 'l'
+	0xDD, 0x09, 25, 2, 31, // 'm'
+	0x1E, 0x0A, 22, 4, 31, // 'n'
+	0x50, 0x0A, 24, 3, 31, // 'o'
+	0x99, 0x0A, 23, 4, 31, // 'p'
+	0xE5, 0x0A, 23, 3, 31, // 'q'
+	0x2F, 0x0B, 20, 6, 31, // 'r'
+	0x50, 0x0B, 22, 4, 31, // 's'
+	0x9B, 0x0B, 20, 5, 31, // 't'
+	0xC0, 0x0B, 21, 5, 31, // 'u'
+	0xEA, 0x0B, 26, 2, 31, // 'v'
+	0x2E, 0x0C, 28, 1, 31, // 'w'
+	0x7F, 0x0C, 24, 3, 31, // 'x'
+	0xD3, 0x0C, 26, 2, 31, // 'y'
+	0x24, 0x0D, 22, 4, 31, // 'z'
+	// packed glyph data
+	0x89, 0x00, 0x00, 0xC0, 0x84, 0xF8, 0x00, 0xE0, 0x91, 0x00, 0x0D, 0xE0, 0xF8, 0xFF, 0xFF, 0x3F,
+	0x07, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFC, 0xE0, 0x8B, 0x00, 0x01, 0xE0, 0xF8, 0x81, 0xFF,
+	0x01, 0x8F, 0x81, 0x84, 0x80, 0x06, 0x81, 0x8F, 0xBF, 0xFF, 0xFF, 0xF8, 0xE0, 0x85, 0x00, 0x05,
+	0xE0, 0xF8, 0xFF, 0xFF, 0x7F, 0x1F, 0x8C, 0x07, 0x08, 0x1F, 0x7F, 0xFF, 0xFF, 0xF8, 0xE0, 0x00,
+	0x00, 0x08, 0x82, 0x0F, 0x00, 0x03, 0x90, 0x00, 0x00, 0x03, 0x82, 0x0F, 0x00, 0x08, 0x9C, 0x00,
+	0x83, 0xF8, 0x87, 0x78, 0x00, 0xF8, 0x81, 0xF0, 0x80, 0xE0, 0x00, 0xC0, 0x81, 0x00, 0x83, 0xFF,
+	0x89, 0x00, 0x00, 0x81, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0x00, 0x83, 0xFF, 0x87, 0x1E, 0x09, 0x1F,
+	0x3F, 0x3F, 0x7B, 0xFB, 0xF1, 0xF0, 0xE0, 0xC0, 0x00, 0x83, 0xFF, 0x88, 0x00, 0x81, 0x80, 0x00,
+	0xC0, 0x82, 0xFF, 0x00, 0x3F, 0x8E, 0x0F, 0x81, 0x07, 0x80, 0x03, 0x00, 0x01, 0x98, 0x00, 0x80,
+	0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x7C, 0x83, 0x3C, 0x80, 0x7C, 0x80, 0xF8,
+	0x07, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0xF0, 0xFE, 0x81, 0xFF, 0x01, 0x0F, 0x03, 0x89, 0x00,
+	0x06, 0x01, 0x03, 0x0F, 0x07, 0x07, 0x06, 0x00, 0x83, 0xFF, 0x92, 0x00, 0x07, 0x03, 0x1F, 0x7F,
+	0xFF, 0xFF, 0xF8, 0xE0, 0x80, 0x87, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xF8, 0x78, 0x18,
+	0x81, 0x00, 0x06, 0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x84, 0x1E, 0x05, 0x1F, 0x0F, 0x0F,
+	0x07, 0x03, 0x01, 0x9A, 0x00, 0x83, 0xF8, 0x85, 0x78, 0x00, 0xF8, 0x81, 0xF0, 0x80, 0xE0, 0x01,
+	0xC0, 0x80, 0x81, 0x00, 0x83, 0xFF, 0x87, 0x00, 0x80, 0x01, 0x06, 0x03, 0x0F, 0x7F, 0xFF, 0xFF,
+	0xFC, 0xF0, 0x83, 0xFF, 0x8B, 0x00, 0x00, 0x80, 0x87, 0xFF, 0x85, 0x00, 0x80, 0x80, 0x80, 0xC0,
+	0x06, 0xF0, 0xF8, 0xFF, 0xFF, 0x7F, 0x1F, 0x03, 0x8B, 0x0F, 0x81, 0x07, 0x80, 0x03, 0x00, 0x01,
+	0x99, 0x00, 0x83, 0xF8, 0x8F, 0x78, 0x00, 0x00, 0x83, 0xFF, 0x90, 0x00, 0x83, 0xFF, 0x8E, 0x1E,
+	0x80, 0x00, 0x83, 0xFF, 0x90, 0x00, 0x95, 0x0F, 0x95, 0x00, 0x82, 0xF8, 0x8F, 0x78, 0x82, 0xFF,
+	0x8F, 0x00, 0x82, 0xFF, 0x8F, 0x78, 0x82, 0xFF, 0x8F, 0x00, 0x82, 0x0F, 0xA4, 0x00, 0x80, 0x00,
+	0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x78, 0x7C, 0x84, 0x3C, 0x09, 0x7C, 0xF8, 0xF8, 0xF0,
+	0xE0, 0xC0, 0x80, 0x00, 0xF0, 0xFE, 0x81, 0xFF, 0x01, 0x0F, 0x01, 0x89, 0x00, 0x05, 0x01, 0x03,
+	0x07, 0x03, 0x03, 0x02, 0x83, 0xFF, 0x85, 0x00, 0x85, 0x78, 0x83, 0xF8, 0x07, 0x03, 0x1F, 0x7F,
+	0xFF, 0xFF, 0xF8, 0xE0, 0x80, 0x89, 0x00, 0x83, 0xFF, 0x81, 0x00, 0x06, 0x01, 0x03, 0x07, 0x07,
+	0x0F, 0x0F, 0x1F, 0x84, 0x1E, 0x00, 0x1F, 0x81, 0x0F, 0x80, 0x07, 0x01, 0x03, 0x01, 0x96, 0x00,
+	0x83, 0xF8, 0x8A, 0x00, 0x83, 0xF8, 0x83, 0xFF, 0x8A, 0x00, 0x88, 0xFF, 0x8A, 0x1E, 0x88, 0xFF,
+	0x8A, 0x00, 0x83, 0xFF, 0x83, 0x0F, 0x8A, 0x00, 0x83, 0x0F, 0x94, 0x00, 0x86, 0x78, 0x82, 0xF8,
+	0x86, 0x78, 0x86, 0x00, 0x82, 0xFF, 0x8E, 0x00, 0x82, 0xFF, 0x8E, 0x00, 0x82, 0xFF, 0x86, 0x00,
+	0x92, 0x0F, 0x92, 0x00, 0x86, 0x00, 0x85, 0x78, 0x83, 0xF8, 0x8D, 0x00, 0x83, 0xFF, 0x8D, 0x00,
+	0x83, 0xFF, 0x01, 0x10, 0xF0, 0x81, 0xF8, 0x01, 0xE0, 0x80, 0x85, 0x00, 0x00, 0x80, 0x82, 0xFF,
+	0x08, 0x3F, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x83, 0x1E, 0x05, 0x1F, 0x0F, 0x0F,
+	0x07, 0x03, 0x01, 0x93, 0x00, 0x83, 0xF8, 0x88, 0x00, 0x0A, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x78,
+	0x38, 0x18, 0x08, 0x00, 0x00, 0x83, 0xFF, 0x81, 0x00, 0x0A, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0x7E,
+	0x3F, 0x1F, 0x0F, 0x03, 0x01, 0x85, 0x00, 0x83, 0xFF, 0x0B, 0xFC, 0x7E, 0x3F, 0x1F, 0x3F, 0x7F,
+	0xFF, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0x87, 0x00, 0x83, 0xFF, 0x85, 0x00, 0x0A, 0x03, 0x07, 0x0F,
+	0x1F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0x81, 0x00, 0x83, 0x0F, 0x8B, 0x00, 0x01, 0x01,
+	0x07, 0x81, 0x0F, 0x02, 0x0E, 0x0C, 0x08, 0x98, 0x00, 0x82, 0xF8, 0x8F, 0x00, 0x82, 0xFF, 0x8F,
+	0x00, 0x82, 0xFF, 0x8F, 0x00, 0x82, 0xFF, 0x8F, 0x00, 0x93, 0x0F, 0x93, 0x00, 0x84, 0xF8, 0x01,
+	0xF0, 0x80, 0x87, 0x00, 0x00, 0xE0, 0x84, 0xF8, 0x82, 0xFF, 0x06, 0x01, 0x0F, 0x7F, 0xFF, 0xFC,
+	0xF0, 0x80, 0x81, 0x00, 0x05, 0xE0, 0xFC, 0xFF, 0x7F, 0x0F, 0x01, 0x86, 0xFF, 0x81, 0x00, 0x09,
+	0x03, 0x0F, 0x7F, 0xFF, 0xFC, 0xF8, 0xFF, 0x7F, 0x0F, 0x03, 0x81, 0x00, 0x86, 0xFF, 0x84, 0x00,
+	0x82, 0x01, 0x84, 0x00, 0x82, 0xFF, 0x82, 0x0F, 0x8E, 0x00, 0x82, 0x0F, 0x96, 0x00, 0x84, 0xF8,
+	0x00, 0xE0, 0x89, 0x00, 0x82, 0xF8, 0x82, 0xFF, 0x06, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0,
+	0x85, 0x00, 0x86, 0xFF, 0x81, 0x00, 0x07, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFC, 0xE0, 0x80, 0x81,
+	0x00, 0x86, 0xFF, 0x85, 0x00, 0x06, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xE0, 0x82, 0xFF, 0x82,
+	0x0F, 0x89, 0x00, 0x00, 0x03, 0x84, 0x0F, 0x94, 0x00, 0x81, 0x00, 0x06, 0x80, 0xE0, 0xF0, 0xF0,
+	0xF8, 0xF8, 0x7C, 0x84, 0x3C, 0x06, 0x7C, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0x81, 0x00, 0x00,
+	0xF8, 0x82, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00, 0x01, 0x01, 0x07, 0x82, 0xFF, 0x01, 0xF8, 0x1C,
+	0x82, 0xFF, 0x00, 0xC1, 0x8C, 0x00, 0x00, 0xC1, 0x82, 0xFF, 0x02, 0x00, 0x0F, 0x3F, 0x81, 0xFF,
+	0x02, 0xF0, 0xC0, 0x80, 0x86, 0x00, 0x02, 0x80, 0xC0, 0xF0, 0x81, 0xFF, 0x01, 0x3F, 0x0F, 0x82,
+	0x00, 0x80, 0x03, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x84, 0x1E, 0x05, 0x1F, 0x0F, 0x0F, 0x07, 0x03,
+	0x01, 0x9A, 0x00, 0x83, 0xF8, 0x88, 0x78, 0x00, 0xF8, 0x81, 0xF0, 0x03, 0xE0, 0xC0, 0x80, 0x00,
+	0x83, 0xFF, 0x8A, 0x00, 0x01, 0x01, 0xC7, 0x81, 0xFF, 0x00, 0xFE, 0x83, 0xFF, 0x87, 0x78, 0x80,
+	0x7C, 0x06, 0x3E, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x83, 0xFF, 0x90, 0x00, 0x83, 0x0F, 0xA7,
+	0x00, 0x81, 0x00, 0x06, 0x80, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0x7C, 0x84, 0x3C, 0x06, 0x7C, 0xF8,
+	0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0x82, 0x00, 0x00, 0xF8, 0x82, 0xFF, 0x01, 0x07, 0x01, 0x88, 0x00,
+	0x01, 0x01, 0x07, 0x82, 0xFF, 0x02, 0xF8, 0x00, 0x1C, 0x82, 0xFF, 0x00, 0xC1, 0x8C, 0x00, 0x00,
+	0xC1, 0x82, 0xFF, 0x80, 0x00, 0x01, 0x0F, 0x3F, 0x81, 0xFF, 0x02, 0xF0, 0xC0, 0x80, 0x86, 0x00,
+	0x02, 0x80, 0xC0, 0xF0, 0x81, 0xFF, 0x01, 0x3F, 0x0F, 0x83, 0x00, 0x08, 0x03, 0x07, 0x07, 0x0F,
+	0x0F, 0x1F, 0x1E, 0x1E, 0x7E, 0x81, 0xFE, 0x05, 0xFF, 0x8F, 0x0F, 0x07, 0x03, 0x01, 0x8F, 0x00,
+	0x06, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x84, 0x1C, 0x83, 0xF8, 0x88, 0x78, 0x00, 0xF8,
+	0x81, 0xF0, 0x80, 0xE0, 0x02, 0xC0, 0x00, 0x00, 0x83, 0xFF, 0x8A, 0x00, 0x01, 0x01, 0xC7, 0x82,
+	0xFF, 0x00, 0x00, 0x83, 0xFF, 0x84, 0x3C, 0x82, 0xFC, 0x08, 0xDE, 0x1E, 0x1F, 0x0F, 0x0F, 0x07,
+	0x03, 0x00, 0x00, 0x83, 0xFF, 0x85, 0x00, 0x0B, 0x01, 0x07, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xF0,
+	0xC0, 0x80, 0x00, 0x00, 0x83, 0x0F, 0x8A, 0x00, 0x01, 0x01, 0x07, 0x81, 0x0F, 0x01, 0x0E, 0x0C,
+	0x96, 0x00, 0x80, 0x00, 0x07, 0x80, 0xE0, 0xF0, 0xF0, 0xF8, 0x78, 0x3C, 0x3C, 0x84, 0x1C, 0x80,
+	0x3C, 0x05, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x80, 0x82, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0x03, 0xE0,
+	0xC0, 0x80, 0x80, 0x87, 0x00, 0x00, 0x01, 0x81, 0x07, 0x01, 0x03, 0x02, 0x82, 0x00, 0x04, 0x01,
+	0x03, 0x03, 0x07, 0x07, 0x82, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x3E, 0x3E, 0x3C, 0x7C, 0xF8, 0xF8,
+	0xF0, 0xF0, 0xE0, 0x80, 0x00, 0x30, 0xF0, 0x81, 0xF8, 0x01, 0xC0, 0x80, 0x8A, 0x00, 0x01, 0x80,
+	0xE1, 0x82, 0xFF, 0x05, 0x0C, 0x00, 0x00, 0x01, 0x03, 0x07, 0x81, 0x0F, 0x00, 0x1F, 0x86, 0x1E,
+	0x00, 0x1F, 0x81, 0x0F, 0x02, 0x07, 0x03, 0x01, 0x9A, 0x00, 0x89, 0x78, 0x82, 0xF8, 0x89, 0x78,
+	0x89, 0x00, 0x82, 0xFF, 0x94, 0x00, 0x82, 0xFF, 0x94, 0x00, 0x82, 0xFF, 0x94, 0x00, 0x82, 0x0F,
+	0xA3, 0x00, 0x83, 0xF8, 0x8C, 0x00, 0x82, 0xF8, 0x83, 0xFF, 0x8C, 0x00, 0x87, 0xFF, 0x8C, 0x00,
+	0x82, 0xFF, 0x01, 0x03, 0x7F, 0x81, 0xFF, 0x01, 0xF0, 0x80, 0x88, 0x00, 0x01, 0x80, 0xF0, 0x81,
+	0xFF, 0x09, 0x7F, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x84, 0x1E, 0x00, 0x1F,
+	0x81, 0x0F, 0x02, 0x07, 0x03, 0x01, 0x96, 0x00, 0x01, 0x08, 0x38, 0x81, 0xF8, 0x01, 0xF0, 0x80,
+	0x8E, 0x00, 0x01, 0x80, 0xF0, 0x81, 0xF8, 0x0B, 0x38, 0x08, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF,
+	0xFF, 0xFC, 0xF0, 0x80, 0x88, 0x00, 0x07, 0x80, 0xF0, 0xFC, 0xFF, 0xFF, 0x3F, 0x0F, 0x01, 0x85,
+	0x00, 0x06, 0x01, 0x0F, 0x3F, 0xFF, 0xFF, 0xFC, 0xE0, 0x84, 0x00, 0x06, 0xE0, 0xFC, 0xFF, 0xFF,
+	0x3F, 0x0F, 0x01, 0x8B, 0x00, 0x0D, 0x01, 0x0F, 0x3F, 0xFF, 0xFF, 0xF8, 0xC0, 0xC0, 0xF8, 0xFF,
+	0xFF, 0x3F, 0x0F, 0x01, 0x91, 0x00, 0x00, 0x01, 0x84, 0x0F, 0x00, 0x01, 0xA7, 0x00, 0x00, 0x38,
+	0x82, 0xF8, 0x92, 0x00, 0x82, 0xF8, 0x02, 0x38, 0x00, 0x1F, 0x81, 0xFF, 0x00, 0xFC, 0x84, 0x00,
+	0x00, 0xC0, 0x82, 0xE0, 0x00, 0xC0, 0x84, 0x00, 0x00, 0xFC, 0x81, 0xFF, 0x00, 0x0F, 0x81, 0x00,
+	0x00, 0x07, 0x81, 0xFF, 0x00, 0xFC, 0x81, 0x00, 0x09, 0xC0, 0xFC, 0xFF, 0xFF, 0x0F, 0x07, 0xFF,
+	0xFF, 0xFC, 0xC0, 0x81, 0x00, 0x00, 0xFC, 0x81, 0xFF, 0x00, 0x07, 0x83, 0x00, 0x00, 0x01, 0x81,
+	0xFF, 0x05, 0xFC, 0xC0, 0xFC, 0xFF, 0x7F, 0x0F, 0x82, 0x00, 0x05, 0x07, 0x7F, 0xFF, 0xFC, 0xC0,
+	0xF8, 0x81, 0xFF, 0x00, 0x01, 0x86, 0x00, 0x83, 0x0F, 0x00, 0x07, 0x86, 0x00, 0x00, 0x07, 0x83,
+	0x0F, 0xA1, 0x00, 0x08, 0x00, 0x08, 0x18, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x88, 0x00, 0x07,
+	0x80, 0xC0, 0xF0, 0xF8, 0xF8, 0x78, 0x18, 0x08, 0x84, 0x00, 0x11, 0x03, 0x07, 0x1F, 0x3F, 0xFE,
+	0xFC, 0xF0, 0xE0, 0x80, 0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0x3F, 0x1F, 0x07, 0x03, 0x8B, 0x00, 0x0B,
+	0x80, 0xC0, 0xF1, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xFF, 0xF1, 0xC0, 0x80, 0x89, 0x00, 0x08, 0x80,
+	0xE0, 0xF0, 0xFC, 0xFE, 0x3F, 0x1F, 0x07, 0x03, 0x82, 0x00, 0x08, 0x03, 0x07, 0x1F, 0x3F, 0xFE,
+	0xFC, 0xF0, 0xE0, 0x80, 0x81, 0x00, 0x01, 0x08, 0x0C, 0x81, 0x0F, 0x01, 0x07, 0x03, 0x8C, 0x00,
+	0x01, 0x03, 0x07, 0x81, 0x0F, 0x01, 0x0C, 0x08, 0x9A, 0x00, 0x07, 0x08, 0x38, 0x78, 0xF8, 0xF8,
+	0xF0, 0xC0, 0x80, 0x8A, 0x00, 0x07, 0x80, 0xC0, 0xF0, 0xF8, 0xF8, 0x78, 0x38, 0x08, 0x81, 0x00,
+	0x08, 0x01, 0x03, 0x0F, 0x3F, 0x7F, 0xFE, 0xF8, 0xF0, 0xC0, 0x82, 0x00, 0x08, 0xC0, 0xF0, 0xF8,
+	0xFE, 0x7F, 0x3F, 0x0F, 0x03, 0x01, 0x89, 0x00, 0x0B, 0x01, 0x03, 0x0F, 0x3F, 0xFF, 0xFE, 0xFE,
+	0xFF, 0x3F, 0x0F, 0x03, 0x01, 0x92, 0x00, 0x82, 0xFF, 0x96, 0x00, 0x82, 0x0F, 0xA6, 0x00, 0x80,
+	0x00, 0x8F, 0x78, 0x83, 0xF8, 0x00, 0x78, 0x8C, 0x00, 0x0A, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x7E,
+	0x3F, 0x0F, 0x07, 0x03, 0x01, 0x87, 0x00, 0x09, 0x80, 0xE0, 0xF0, 0xF8, 0xFE, 0x7F, 0x1F, 0x0F,
+	0x07, 0x01, 0x87, 0x00, 0x0A, 0x80, 0xC0, 0xE0, 0xF0, 0xFC, 0x7E, 0x3F, 0x1F, 0x0F, 0x03, 0x01,
+	0x8D, 0x00, 0x98, 0x0F, 0x98, 0x00, 0x82, 0xFF, 0x87, 0x07, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF,
+	0x87, 0x00, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF, 0x87, 0x00, 0x82, 0x3F, 0x87, 0x38, 0x07, 0x01,
+	0x07, 0x1F, 0x7F, 0xFE, 0xFC, 0xF0, 0xC0, 0x93, 0x00, 0x07, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8,
+	0xE0, 0x80, 0x92, 0x00, 0x07, 0x03, 0x07, 0x1F, 0x7F, 0xFE, 0xF8, 0xF0, 0xC0, 0x92, 0x00, 0x08,
+	0x01, 0x07, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xE0, 0x80, 0x92, 0x00, 0x00, 0x03, 0x81, 0x0F, 0x01,
+	0x0E, 0x08, 0x96, 0x00, 0x87, 0x07, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF,
+	0x87, 0x00, 0x82, 0xFF, 0x87, 0x00, 0x82, 0xFF, 0x87, 0x38, 0x82, 0x3F, 0x86, 0x00, 0x07, 0xE0,
+	0xF8, 0xF8, 0x78, 0x78, 0xF8, 0xF8, 0xC0, 0x89, 0x00, 0x0F, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x07,
+	0x01, 0x00, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFC, 0xE0, 0x80, 0x82, 0x00, 0x05, 0xC0, 0xF0, 0xFE,
+	0xFF, 0x1F, 0x07, 0x87, 0x00, 0x06, 0x01, 0x07, 0x1F, 0xFF, 0xFE, 0xF0, 0xC0, 0x82, 0x01, 0x8E,
+	0x00, 0x81, 0x01, 0xAC, 0x00, 0xF6, 0x00, 0x9C, 0x80, 0x9C, 0x01, 0x09, 0x02, 0x06, 0x0E, 0x0E,
+	0x1E, 0x3C, 0x78, 0x70, 0x60, 0x40, 0xB0, 0x00, 0x98, 0x00, 0x07, 0x80, 0xE0, 0xF0, 0xF8, 0xFC,
+	0x7C, 0x1E, 0x1E, 0x83, 0x0E, 0x80, 0x1E, 0x04, 0x7C, 0xFC, 0xF8, 0xF0, 0xC0, 0x83, 0x00, 0x07,
+	0x01, 0x81, 0xC1, 0xE1, 0xE1, 0xE0, 0xF0, 0xF0, 0x86, 0x70, 0x82, 0xFF, 0x82, 0x00, 0x00, 0xFC,
+	0x82, 0xFF, 0x01, 0x03, 0x01, 0x86, 0x00, 0x01, 0xC0, 0xF0, 0x82, 0xFF, 0x00, 0x80, 0x82, 0x00,
+	0x05, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x82, 0x1C, 0x07, 0x0C, 0x0E, 0x0E, 0x07, 0x03, 0x00,
+	0x03, 0x0F, 0x81, 0x1F, 0x81, 0x1C, 0x97, 0x00, 0x00, 0x00, 0x82, 0xFF, 0x91, 0x00, 0x82, 0xFF,
+	0x04, 0xE0, 0x78, 0x38, 0x1C, 0x0C, 0x82, 0x0E, 0x80, 0x1E, 0x07, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0,
+	0x80, 0x00, 0x00, 0x82, 0xFF, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x82, 0xFF, 0x01, 0xF0, 0x00,
+	0x82, 0xFF, 0x01, 0xE0, 0x80, 0x87, 0x00, 0x01, 0x80, 0xE0, 0x81, 0xFF, 0x02, 0x7F, 0x03, 0x0E,
+	0x82, 0x0F, 0x03, 0x03, 0x07, 0x0E, 0x0E, 0x83, 0x1C, 0x80, 0x1E, 0x80, 0x0F, 0x02, 0x07, 0x03,
+	0x01, 0x97, 0x00, 0x97, 0x00, 0x06, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1E, 0x84, 0x0E, 0x08,
+	0x1E, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xF8, 0x82, 0xFF, 0x00, 0x01, 0x8B, 0x00, 0x82,
+	0x01, 0x01, 0x07, 0x7F, 0x81, 0xFF, 0x01, 0xE0, 0x80, 0x88, 0x00, 0x01, 0x80, 0xE0, 0x81, 0xF0,
+	0x00, 0x70, 0x81, 0x00, 0x05, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x84, 0x1C, 0x06, 0x1E, 0x0E,
+	0x0F, 0x07, 0x07, 0x03, 0x01, 0x96, 0x00, 0x90, 0x00, 0x82, 0xFF, 0x80, 0x00, 0x07, 0x80, 0xE0,
+	0xF0, 0xF8, 0xFC, 0x3C, 0x1E, 0x1E, 0x83, 0x0E, 0x80, 0x1C, 0x01, 0x78, 0xE0, 0x82, 0xFF, 0x01,
+	0x00, 0xF0, 0x82, 0xFF, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x82, 0xFF, 0x02, 0x00, 0x03, 0x7F,
+	0x81, 0xFF, 0x00, 0xE0, 0x88, 0x00, 0x01, 0x80, 0xF0, 0x82, 0xFF, 0x81, 0x00, 0x06, 0x01, 0x07,
+	0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x82, 0x1C, 0x04, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x82, 0x0F, 0x00,
+	0x0C, 0x95, 0x00, 0x98, 0x00, 0x06, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1E, 0x84, 0x0E, 0x09,
+	0x1E, 0x1C, 0x7C, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0xF8, 0x82, 0xFF, 0x00, 0x71, 0x8A, 0x70,
+	0x00, 0x71, 0x82, 0x7F, 0x02, 0x78, 0x03, 0x3F, 0x81, 0xFF, 0x01, 0xF0, 0x80, 0x89, 0x00, 0x04,
+	0x80, 0xC0, 0xC0, 0x80, 0x80, 0x82, 0x00, 0x06, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x83,
+	0x1C, 0x06, 0x1E, 0x0E, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x98, 0x00, 0x85, 0x00, 0x06, 0xE0, 0xF8,
+	0xFC, 0xFE, 0x3E, 0x1F, 0x0F, 0x88, 0x07, 0x85, 0x1C, 0x82, 0xFF, 0x8A, 0x1C, 0x86, 0x00, 0x82,
+	0xFF, 0x92, 0x00, 0x82, 0xFF, 0x92, 0x00, 0x82, 0x0F, 0xA3, 0x00, 0x96, 0x00, 0x07, 0x80, 0xE0,
+	0xF0, 0xF8, 0xFC, 0x3C, 0x1E, 0x1E, 0x82, 0x0E, 0x04, 0x0C, 0x1C, 0x38, 0x78, 0xE0, 0x83, 0xFC,
+	0x00, 0xC0, 0x82, 0xFF, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x83, 0xFF, 0x01, 0x00, 0x3F, 0x81,
+	0xFF, 0x01, 0xF0, 0x80, 0x86, 0x00, 0x02, 0x80, 0xC0, 0xF0, 0x83, 0xFF, 0x81, 0x00, 0x04, 0x83,
+	0x87, 0x87, 0x8F, 0x0F, 0x83, 0x0E, 0x04, 0x06, 0x07, 0x03, 0x01, 0x00, 0x82, 0xFF, 0x00, 0x1F,
+	0x81, 0x00, 0x05, 0x03, 0x0F, 0x0F, 0x1F, 0x1E, 0x3C, 0x84, 0x38, 0x07, 0x3C, 0x1E, 0x1F, 0x0F,
+	0x0F, 0x07, 0x01, 0x00, 0x82, 0xFF, 0x8F, 0x00, 0x82, 0xFF, 0x04, 0xE0, 0x70, 0x38, 0x1C, 0x0C,
+	0x82, 0x0E, 0x80, 0x1E, 0x05, 0x7E, 0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x82, 0xFF, 0x00, 0x01, 0x89,
+	0x00, 0x87, 0xFF, 0x8A, 0x00, 0x83, 0xFF, 0x82, 0x0F, 0x8A, 0x00, 0x83, 0x0F, 0x93, 0x00, 0x88,
+	0x00, 0x83, 0x1F, 0x8A, 0x00, 0x86, 0x1C, 0x82, 0xFC, 0x92, 0x00, 0x82, 0xFF, 0x92, 0x00, 0x82,
+	0xFF, 0x87, 0x00, 0x89, 0x0E, 0x82, 0x0F, 0x87, 0x0E, 0x96, 0x00, 0x8B, 0x00, 0x82, 0x1F, 0x81,
+	0x00, 0x88, 0x1C, 0x82, 0xFC, 0x8B, 0x00, 0x82, 0xFF, 0x8B, 0x00, 0x82, 0xFF, 0x8B, 0x00, 0x82,
+	0xFF, 0x00, 0x1C, 0x87, 0x38, 0x06, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x82, 0xFF, 0x8F,
+	0x00, 0x82, 0xFF, 0x85, 0x00, 0x09, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x7C, 0x3C, 0x1C, 0x04, 0x00,
+	0x82, 0xFF, 0x0A, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xDF, 0x8F, 0x07, 0x03, 0x01, 0x84, 0x00,
+	0x82, 0xFF, 0x0D, 0x03, 0x01, 0x01, 0x00, 0x03, 0x07, 0x0F, 0x3F, 0x7F, 0xFC, 0xF8, 0xF0, 0xE0,
+	0x80, 0x81, 0x00, 0x82, 0x0F, 0x88, 0x00, 0x01, 0x03, 0x07, 0x81, 0x0F, 0x01, 0x0E, 0x08, 0x93,
+	0x00, 0x82, 0x00, 0x85, 0x07, 0x82, 0xFF, 0x92, 0x00, 0x82, 0xFF, 0x92, 0x00, 0x82, 0xFF, 0x92,
+	0x00, 0x82, 0xFF, 0x87, 0x00, 0x89, 0x0E, 0x82, 0x0F, 0x87, 0x0E, 0x96, 0x00, 0x97, 0x00, 0x00,
+	0x04, 0x81, 0xFC, 0x02, 0xE0, 0x78, 0x1C, 0x81, 0x0E, 0x0F, 0x3E, 0xFE, 0xFC, 0xF8, 0xE0, 0xF8,
+	0x1C, 0x0C, 0x0E, 0x0E, 0x1E, 0xFE, 0xFC, 0xFC, 0xF0, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x82, 0xFF,
+	0x84, 0x00, 0x82, 0xFF, 0x00, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x82, 0xFF, 0x84, 0x00, 0x82, 0xFF,
+	0x00, 0x00, 0x82, 0x0F, 0x84, 0x00, 0x82, 0x0F, 0x84, 0x00, 0x82, 0x0F, 0x97, 0x00, 0x94, 0x00,
+	0x00, 0x1C, 0x82, 0xFC, 0x04, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x82, 0x0E, 0x80, 0x1E, 0x06, 0x7E,
+	0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x82, 0xFF, 0x00, 0x01, 0x89, 0x00, 0x83, 0xFF, 0x00, 0x00,
+	0x82, 0xFF, 0x8A, 0x00, 0x83, 0xFF, 0x00, 0x00, 0x82, 0x0F, 0x8A, 0x00, 0x83, 0x0F, 0x94, 0x00,
+	0x97, 0x00, 0x07, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1E, 0x84, 0x0E, 0x09, 0x1E, 0x1C,
+	0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0xF8, 0x82, 0xFF, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x01,
+	0x82, 0xFF, 0x02, 0xF8, 0x07, 0x7F, 0x81, 0xFF, 0x01, 0xE0, 0x80, 0x88, 0x00, 0x01, 0x80, 0xE0,
+	0x81, 0xFF, 0x01, 0x3F, 0x07, 0x81, 0x00, 0x05, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x84, 0x1C,
+	0x05, 0x1E, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x99, 0x00, 0x95, 0x00, 0x00, 0x1C, 0x82, 0xFC, 0x04,
+	0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x82, 0x0E, 0x80, 0x1E, 0x07, 0x3C, 0xFC, 0xF8, 0xF8, 0xE0, 0x80,
+	0x00, 0x00, 0x82, 0xFF, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x82, 0xFF, 0x01, 0xF0, 0x00, 0x82,
+	0xFF, 0x01, 0xE0, 0x80, 0x88, 0x00, 0x00, 0xE0, 0x81, 0xFF, 0x02, 0x7F, 0x03, 0x00, 0x82, 0xFF,
+	0x03, 0x01, 0x07, 0x0E, 0x0E, 0x83, 0x1C, 0x80, 0x1E, 0x80, 0x0F, 0x02, 0x07, 0x03, 0x01, 0x81,
+	0x00, 0x82, 0x3F, 0x90, 0x00, 0x96, 0x00, 0x07, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1E, 0x1E,
+	0x83, 0x0E, 0x80, 0x1C, 0x01, 0x78, 0xE0, 0x82, 0xFE, 0x01, 0x1E, 0xF0, 0x82, 0xFF, 0x00, 0x01,
+	0x89, 0x00, 0x00, 0x01, 0x82, 0xFF, 0x02, 0x00, 0x03, 0x7F, 0x81, 0xFF, 0x00, 0xE0, 0x88, 0x00,
+	0x01, 0x80, 0xF0, 0x82, 0xFF, 0x81, 0x00, 0x06, 0x01, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x82,
+	0x1C, 0x04, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x82, 0xFF, 0x91, 0x00, 0x82, 0x3F, 0x00, 0x00, 0x92,
+	0x00, 0x00, 0x1C, 0x81, 0xFC, 0x06, 0xF8, 0x80, 0xE0, 0xF0, 0x78, 0x7C, 0x3C, 0x87, 0x1E, 0x00,
+	0x00, 0x83, 0xFF, 0x01, 0x03, 0x01, 0x8B, 0x00, 0x83, 0xFF, 0x8D, 0x00, 0x83, 0x0F, 0xA0, 0x00,
+	0x95, 0x00, 0x06, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x1C, 0x1E, 0x85, 0x0E, 0x0E, 0x1C, 0x3C, 0xFC,
+	0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x07, 0x1F, 0x3F, 0x3F, 0x7E, 0x78, 0xF8, 0x81, 0xF0, 0x82, 0xE0,
+	0x81, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x00, 0x80, 0x81, 0xC0, 0x00, 0x80, 0x83, 0x00, 0x82, 0x01,
+	0x80, 0x03, 0x0C, 0x07, 0x8F, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0E, 0x1E,
+	0x86, 0x1C, 0x80, 0x0E, 0x03, 0x0F, 0x07, 0x03, 0x01, 0x95, 0x00, 0x82, 0x00, 0x00, 0x80, 0x81,
+	0xF8, 0x8A, 0x00, 0x82, 0x1C, 0x82, 0xFF, 0x89, 0x1C, 0x83, 0x00, 0x82, 0xFF, 0x8E, 0x00, 0x82,
+	0xFF, 0x8E, 0x00, 0x05, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x86, 0x1C, 0x80, 0x0E, 0x92, 0x00,
+	0x93, 0x00, 0x82, 0xFC, 0x8A, 0x00, 0x83, 0xFC, 0x82, 0xFF, 0x8A, 0x00, 0x87, 0xFF, 0x00, 0x80,
+	0x88, 0x00, 0x00, 0xC0, 0x83, 0xFF, 0x05, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x83, 0x1C, 0x05,
+	0x0C, 0x0E, 0x06, 0x07, 0x01, 0x03, 0x82, 0x0F, 0x93, 0x00, 0x98, 0x00, 0x01, 0x0C, 0x3C, 0x81,
+	0xFC, 0x01, 0xF0, 0x80, 0x8A, 0x00, 0x01, 0x80, 0xF0, 0x81, 0xFC, 0x0B, 0x3C, 0x0C, 0x00, 0x00,
+	0x01, 0x07, 0x3F, 0xFF, 0xFF, 0xFE, 0xF0, 0x80, 0x84, 0x00, 0x07, 0xC0, 0xF0, 0xFE, 0xFF, 0xFF,
+	0x3F, 0x07, 0x01, 0x86, 0x00, 0x0D, 0x07, 0x1F, 0xFF, 0xFF, 0xFE, 0xF0, 0x80, 0xC0, 0xF8, 0xFE,
+	0xFF, 0x7F, 0x1F, 0x03, 0x8D, 0x00, 0x00, 0x03, 0x84, 0x0F, 0x00, 0x01, 0xA1, 0x00, 0x9A, 0x00,
+	0x82, 0xFC, 0x00, 0xC0, 0x90, 0x00, 0x00, 0xC0, 0x82, 0xFC, 0x01, 0x00, 0x3F, 0x81, 0xFF, 0x00,
+	0xE0, 0x82, 0x00, 0x07, 0xE0, 0xFE, 0xFE, 0x1E, 0x3E, 0xFE, 0xFE, 0xE0, 0x82, 0x00, 0x00, 0xF0,
+	0x81, 0xFF, 0x00, 0x1F, 0x81, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x0F, 0xF0, 0xC0, 0xF8, 0xFF, 0x7F,
+	0x0F, 0x01, 0x00, 0x00, 0x01, 0x0F, 0xFF, 0xFF, 0xF8, 0x80, 0xFC, 0x81, 0xFF, 0x00, 0x07, 0x83,
+	0x00, 0x00, 0x01, 0x83, 0x0F, 0x00, 0x03, 0x86, 0x00, 0x00, 0x07, 0x83, 0x0F, 0x9E, 0x00, 0x96,
+	0x00, 0x08, 0x04, 0x0C, 0x3C, 0x7C, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0x84, 0x00, 0x08, 0x80, 0xC0,
+	0xF0, 0xF8, 0xFC, 0x7C, 0x1C, 0x0C, 0x04, 0x83, 0x00, 0x0D, 0x03, 0x07, 0x0F, 0x1F, 0xFE, 0xFC,
+	0xF0, 0xF8, 0xFC, 0xBE, 0x1F, 0x0F, 0x07, 0x01, 0x86, 0x00, 0x11, 0xC0, 0xE0, 0xF0, 0xFC, 0x7E,
+	0x3F, 0x1F, 0x07, 0x03, 0x03, 0x07, 0x1F, 0x3F, 0xFE, 0xF8, 0xF0, 0xE0, 0x80, 0x81, 0x00, 0x06,
+	0x0C, 0x0E, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x88, 0x00, 0x01, 0x01, 0x03, 0x81, 0x0F, 0x01, 0x0E,
+	0x0C, 0x96, 0x00, 0x98, 0x00, 0x01, 0x0C, 0x3C, 0x81, 0xFC, 0x01, 0xE0, 0x80, 0x8B, 0x00, 0x0F,
+	0xE0, 0xF8, 0xFC, 0xFC, 0x3C, 0x0C, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFC, 0xF0, 0x80,
+	0x84, 0x00, 0x07, 0x80, 0xE0, 0xFC, 0xFF, 0xFF, 0x1F, 0x07, 0x01, 0x86, 0x00, 0x0D, 0x03, 0x0F,
+	0x3F, 0xFF, 0xFE, 0xF8, 0xC0, 0x80, 0xF0, 0xFC, 0xFF, 0x7F, 0x0F, 0x03, 0x8E, 0x00, 0x00, 0xC7,
+	0x81, 0xFF, 0x02, 0x3F, 0x07, 0x01, 0x89, 0x00, 0x82, 0x38, 0x80, 0x3C, 0x04, 0x1E, 0x1F, 0x0F,
+	0x07, 0x01, 0x8B, 0x00, 0x95, 0x00, 0x8B, 0x1C, 0x01, 0x9C, 0xDC, 0x81, 0xFC, 0x01, 0x7C, 0x3C,
+	0x87, 0x00, 0x09, 0xC0, 0xE0, 0xF0, 0xF8, 0x7E, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x83, 0x00, 0x0A,
+	0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x7E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x88, 0x00, 0x83, 0x0F, 0x8F,
+	0x0E, 0x94, 0x00
+};
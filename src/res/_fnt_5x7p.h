@@ -0,0 +1,255 @@
+/****************************************************************************** 
+font5x7p.h
+Proportional version of the small (5x7) font - each glyph is trimmed to its
+used columns, and is followed by a one pixel space.
+
+This file was imported from the MicroView library, written by GeekAmmo
+(https://github.com/geekammo/MicroView-Arduino-Library), and released under 
+the terms of the GNU General Public License as published by the Free Software 
+Foundation, either version 3 of the License, or (at your option) any later 
+version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Modified by:
+Emil Varughese @ Edwin Robotics Pvt. Ltd.
+July 27, 2015
+https://github.com/emil01/SparkFun_Micro_OLED_Arduino_Library/
+
+******************************************************************************/
+#pragma once
+
+// Define the font attributes
+#define FONT_5X7P_WIDTH        5
+#define FONT_5X7P_HEIGHT       8
+#define FONT_5X7P_START        32
+#define FONT_5X7P_NCHAR        95
+#define FONT_5X7P_NKERN        20
+#define FONT_5X7P_NAME         "5 x 7 Proportional"
+
+// Glyph records, kerning pairs and glyph data - see QwPropFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font5x7p_data[] = {
+#else
+	static const uint8_t font5x7p_data[] PROGMEM = {
+#endif
+	// glyph records - offset, width, x offset, advance
+	0x00, 0x00, 0, 0, 3, // ' '
+	0x00, 0x00, 1, 0, 2, // '!'
+	0x01, 0x00, 3, 0, 4, // '"'
+	0x04, 0x00, 5, 0, 6, // '#'
+	0x09, 0x00, 5, 0, 6, // '$'
+	0x0E, 0x00, 5, 0, 6, // '%'
+	0x13, 0x00, 5, 0, 6, // '&'
+	0x18, 0x00, 3, 0, 4, // "'"
+	0x1B, 0x00, 3, 0, 4, // '('
+	0x1E, 0x00, 3, 0, 4, // ')'
+	0x21, 0x00, 5, 0, 6, // '*'
+	0x26, 0x00, 5, 0, 6, // '+'
+	0x2B, 0x00, 3, 0, 4, // ','
+	0x2E, 0x00, 5, 0, 6, // '-'
+	0x33, 0x00, 2, 0, 3, // '.'
+	0x35, 0x00, 5, 0, 6, // '/'
+	0x3A, 0x00, 5, 0, 6, // '0'
+	0x3F, 0x00, 3, 0, 4, // '1'
+	0x42, 0x00, 5, 0, 6, // '2'
+	0x47, 0x00, 5, 0, 6, // '3'
+	0x4C, 0x00, 5, 0, 6, // '4'
+	0x51, 0x00, 5, 0, 6, // '5'
+	0x56, 0x00, 5, 0, 6, // '6'
+	0x5B, 0x00, 5, 0, 6, // '7'
+	0x60, 0x00, 5, 0, 6, // '8'
+	0x65, 0x00, 5, 0, 6, // '9'
+	0x6A, 0x00, 1, 0, 2, // ':'
+	0x6B, 0x00, 2, 0, 3, // ';'
+	0x6D, 0x00, 4, 0, 5, // '<'
+	0x71, 0x00, 5, 0, 6, // '='
+	0x76, 0x00, 4, 0, 5, // '>'
+	0x7A, 0x00, 5, 0, 6, // '?'
+	0x7F, 0x00, 5, 0, 6, // '@'
+	0x84, 0x00, 5, 0, 6, // 'A'
+	0x89, 0x00, 5, 0, 6, // 'B'
+	0x8E, 0x00, 5, 0, 6, // 'C'
+	0x93, 0x00, 5, 0, 6, // 'D'
+	0x98, 0x00, 5, 0, 6, // 'E'
+	0x9D, 0x00, 5, 0, 6, // 'F'
+	0xA2, 0x00, 5, 0, 6, // 'G'
+	0xA7, 0x00, 5, 0, 6, // 'H'
+	0xAC, 0x00, 3, 0, 4, // 'I'
+	0xAF, 0x00, 5, 0, 6, // 'J'
+	0xB4, 0x00, 5, 0, 6, // 'K'
+	0xB9, 0x00, 5, 0, 6, // 'L'
+	0xBE, 0x00, 5, 0, 6, // 'M'
+	0xC3, 0x00, 5, 0, 6, // 'N'
+	0xC8, 0x00, 5, 0, 6, // 'O'
+	0xCD, 0x00, 5, 0, 6, // 'P'
+	0xD2, 0x00, 5, 0, 6, // 'Q'
+	0xD7, 0x00, 5, 0, 6, // 'R'
+	0xDC, 0x00, 5, 0, 6, // 'S'
+	0xE1, 0x00, 5, 0, 6, // 'T'
+	0xE6, 0x00, 5, 0, 6, // 'U'
+	0xEB, 0x00, 5, 0, 6, // 'V'
+	0xF0, 0x00, 5, 0, 6, // 'W'
+	0xF5, 0x00, 5, 0, 6, // 'X'
+	0xFA, 0x00, 5, 0, 6, // 'Y'
+	0xFF, 0x00, 5, 0, 6, // 'Z'
+	0x04, 0x01, 4, 0, 5, // '['
+	0x08, 0x01, 5, 0, 6, // '\\'
+	0x0D, 0x01, 4, 0, 5, // ']'
+	0x11, 0x01, 5, 0, 6, // '^'
+	0x16, 0x01, 5, 0, 6, // '_'
+	0x1B, 0x01, 3, 0, 4, // '`'
+	0x1E, 0x01, 5, 0, 6, // 'a'
+	0x23, 0x01, 5, 0, 6, // 'b'
+	0x28, 0x01, 5, 0, 6, // 'c'
+	0x2D, 0x01, 5, 0, 6, // 'd'
+	0x32, 0x01, 5, 0, 6, // 'e'
+	0x37, 0x01, 4, 0, 5, // 'f'
+	0x3B, 0x01, 5, 0, 6, // 'g'
+	0x40, 0x01, 5, 0, 6, // 'h'
+	0x45, 0x01, 3, 0, 4, // 'i'
+	0x48, 0x01, 4, 0, 5, // 'j'
+	0x4C, 0x01, 4, 0, 5, // 'k'
+	0x50, 0x01, 3, 0, 4, // 'l'
+	0x53, 0x01, 5, 0, 6, // 'm'
+	0x58, 0x01, 5, 0, 6, // 'n'
+	0x5D, 0x01, 5, 0, 6, // 'o'
+	0x62, 0x01, 5, 0, 6, // 'p'
+	0x67, 0x01, 5, 0, 6, // 'q'
+	0x6C, 0x01, 5, 0, 6, // 'r'
+	0x71, 0x01, 5, 0, 6, // 's'
+	0x76, 0x01, 5, 0, 6, // 't'
+	0x7B, 0x01, 5, 0, 6, // 'u'
+	0x80, 0x01, 5, 0, 6, // 'v'
+	0x85, 0x01, 5, 0, 6, // 'w'
+	0x8A, 0x01, 5, 0, 6, // 'x'
+	0x8F, 0x01, 5, 0, 6, // 'y'
+	0x94, 0x01, 5, 0, 6, // 'z'
+	0x99, 0x01, 3, 0, 4, // '{'
+	0x9C, 0x01, 1, 0, 2, // '|'
+	0x9D, 0x01, 3, 0, 4, // '}'
+	0xA0, 0x01, 5, 0, 6, // '~'
+	// kerning pairs - left, right, adjust
+	0x46, 0x00, 0x61, 0x00, 0xFF, // 'F' 'a'
+	0x46, 0x00, 0x6F, 0x00, 0xFF, // 'F' 'o'
+	0x4C, 0x00, 0x54, 0x00, 0xFF, // 'L' 'T'
+	0x4C, 0x00, 0x56, 0x00, 0xFF, // 'L' 'V'
+	0x4C, 0x00, 0x59, 0x00, 0xFF, // 'L' 'Y'
+	0x50, 0x00, 0x61, 0x00, 0xFF, // 'P' 'a'
+	0x50, 0x00, 0x6F, 0x00, 0xFF, // 'P' 'o'
+	0x54, 0x00, 0x61, 0x00, 0xFF, // 'T' 'a'
+	0x54, 0x00, 0x63, 0x00, 0xFF, // 'T' 'c'
+	0x54, 0x00, 0x65, 0x00, 0xFF, // 'T' 'e'
+	0x54, 0x00, 0x6F, 0x00, 0xFF, // 'T' 'o'
+	0x54, 0x00, 0x73, 0x00, 0xFF, // 'T' 's'
+	0x54, 0x00, 0x75, 0x00, 0xFF, // 'T' 'u'
+	0x56, 0x00, 0x61, 0x00, 0xFF, // 'V' 'a'
+	0x56, 0x00, 0x6F, 0x00, 0xFF, // 'V' 'o'
+	0x57, 0x00, 0x6F, 0x00, 0xFF, // 'W' 'o'
+	0x59, 0x00, 0x61, 0x00, 0xFF, // 'Y' 'a'
+	0x59, 0x00, 0x6F, 0x00, 0xFF, // 'Y' 'o'
+	0x66, 0x00, 0x66, 0x00, 0xFF, // 'f' 'f'
+	0x72, 0x00, 0x61, 0x00, 0xFF, // 'r' 'a'
+	// glyph data
+	0x5F,
+	0x07, 0x00, 0x07,
+	0x14, 0x7F, 0x14, 0x7F, 0x14,
+	0x24, 0x2A, 0x7F, 0x2A, 0x12,
+	0x23, 0x13, 0x08, 0x64, 0x62,
+	0x36, 0x49, 0x56, 0x20, 0x50,
+	0x08, 0x07, 0x03,
+	0x1C, 0x22, 0x41,
+	0x41, 0x22, 0x1C,
+	0x2A, 0x1C, 0x7F, 0x1C, 0x2A,
+	0x08, 0x08, 0x3E, 0x08, 0x08,
+	0x80, 0x70, 0x30,
+	0x08, 0x08, 0x08, 0x08, 0x08,
+	0x60, 0x60,
+	0x20, 0x10, 0x08, 0x04, 0x02,
+	0x3E, 0x51, 0x49, 0x45, 0x3E,
+	0x42, 0x7F, 0x40,
+	0x72, 0x49, 0x49, 0x49, 0x46,
+	0x21, 0x41, 0x49, 0x4D, 0x33,
+	0x18, 0x14, 0x12, 0x7F, 0x10,
+	0x27, 0x45, 0x45, 0x45, 0x39,
+	0x3C, 0x4A, 0x49, 0x49, 0x31,
+	0x41, 0x21, 0x11, 0x09, 0x07,
+	0x36, 0x49, 0x49, 0x49, 0x36,
+	0x46, 0x49, 0x49, 0x29, 0x1E,
+	0x14,
+	0x40, 0x34,
+	0x08, 0x14, 0x22, 0x41,
+	0x14, 0x14, 0x14, 0x14, 0x14,
+	0x41, 0x22, 0x14, 0x08,
+	0x02, 0x01, 0x59, 0x09, 0x06,
+	0x3E, 0x41, 0x5D, 0x59, 0x4E,
+	0x7C, 0x12, 0x11, 0x12, 0x7C,
+	0x7F, 0x49, 0x49, 0x49, 0x36,
+	0x3E, 0x41, 0x41, 0x41, 0x22,
+	0x7F, 0x41, 0x41, 0x41, 0x3E,
+	0x7F, 0x49, 0x49, 0x49, 0x41,
+	0x7F, 0x09, 0x09, 0x09, 0x01,
+	0x3E, 0x41, 0x41, 0x51, 0x73,
+	0x7F, 0x08, 0x08, 0x08, 0x7F,
+	0x41, 0x7F, 0x41,
+	0x20, 0x40, 0x41, 0x3F, 0x01,
+	0x7F, 0x08, 0x14, 0x22, 0x41,
+	0x7F, 0x40, 0x40, 0x40, 0x40,
+	0x7F, 0x02, 0x1C, 0x02, 0x7F,
+	0x7F, 0x04, 0x08, 0x10, 0x7F,
+	0x3E, 0x41, 0x41, 0x41, 0x3E,
+	0x7F, 0x09, 0x09, 0x09, 0x06,
+	0x3E, 0x41, 0x51, 0x21, 0x5E,
+	0x7F, 0x09, 0x19, 0x29, 0x46,
+	0x26, 0x49, 0x49, 0x49, 0x32,
+	0x03, 0x01, 0x7F, 0x01, 0x03,
+	0x3F, 0x40, 0x40, 0x40, 0x3F,
+	0x1F, 0x20, 0x40, 0x20, 0x1F,
+	0x3F, 0x40, 0x38, 0x40, 0x3F,
+	0x63, 0x14, 0x08, 0x14, 0x63,
+	0x03, 0x04, 0x78, 0x04, 0x03,
+	0x61, 0x59, 0x49, 0x4D, 0x43,
+	0x7F, 0x41, 0x41, 0x41,
+	0x02, 0x04, 0x08, 0x10, 0x20,
+	0x41, 0x41, 0x41, 0x7F,
+	0x04, 0x02, 0x01, 0x02, 0x04,
+	0x40, 0x40, 0x40, 0x40, 0x40,
+	0x03, 0x07, 0x08,
+	0x20, 0x54, 0x54, 0x78, 0x40,
+	0x7F, 0x28, 0x44, 0x44, 0x38,
+	0x38, 0x44, 0x44, 0x44, 0x28,
+	0x38, 0x44, 0x44, 0x28, 0x7F,
+	0x38, 0x54, 0x54, 0x54, 0x18,
+	0x08, 0x7E, 0x09, 0x02,
+	0x18, 0xA4, 0xA4, 0x9C, 0x78,
+	0x7F, 0x08, 0x04, 0x04, 0x78,
+	0x44, 0x7D, 0x40,
+	0x20, 0x40, 0x40, 0x3D,
+	0x7F, 0x10, 0x28, 0x44,
+	0x41, 0x7F, 0x40,
+	0x7C, 0x04, 0x78, 0x04, 0x78,
+	0x7C, 0x08, 0x04, 0x04, 0x78,
+	0x38, 0x44, 0x44, 0x44, 0x38,
+	0xFC, 0x18, 0x24, 0x24, 0x18,
+	0x18, 0x24, 0x24, 0x18, 0xFC,
+	0x7C, 0x08, 0x04, 0x04, 0x08,
+	0x48, 0x54, 0x54, 0x54, 0x24,
+	0x04, 0x04, 0x3F, 0x44, 0x24,
+	0x3C, 0x40, 0x40, 0x20, 0x7C,
+	0x1C, 0x20, 0x40, 0x20, 0x1C,
+	0x3C, 0x40, 0x30, 0x40, 0x3C,
+	0x44, 0x28, 0x10, 0x28, 0x44,
+	0x4C, 0x90, 0x90, 0x90, 0x7C,
+	0x44, 0x64, 0x54, 0x4C, 0x44,
+	0x08, 0x36, 0x41,
+	0x77,
+	0x41, 0x36, 0x08,
+	0x02, 0x01, 0x02, 0x04, 0x02
+};
@@ -0,0 +1,443 @@
+/****************************************************************************** 
+font5x7u.h
+Unicode version of the small (5x7) font - a sparse font with the glyphs of
+the 5x7 font (code page 437) mapped to their Unicode characters.
+
+This file was imported from the MicroView library, written by GeekAmmo
+(https://github.com/geekammo/MicroView-Arduino-Library), and released under 
+the terms of the GNU General Public License as published by the Free Software 
+Foundation, either version 3 of the License, or (at your option) any later 
+version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Modified by:
+Emil Varughese @ Edwin Robotics Pvt. Ltd.
+July 27, 2015
+https://github.com/emil01/SparkFun_Micro_OLED_Arduino_Library/
+
+******************************************************************************/
+#pragma once
+
+// Define the font attributes
+#define FONT_5X7U_WIDTH        5
+#define FONT_5X7U_HEIGHT       8
+#define FONT_5X7U_NGLYPH       254
+#define FONT_5X7U_NKERN        0
+#define FONT_5X7U_NAME         "5 x 7 Unicode"
+
+// Character codes, glyph records and glyph data - see QwSparseFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font5x7u_data[] = {
+#else
+	static const uint8_t font5x7u_data[] PROGMEM = {
+#endif
+	// character codes
+	0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00,
+	0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00,
+	0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00,
+	0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00,
+	0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00,
+	0x48, 0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00,
+	0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00,
+	0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00,
+	0x60, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00,
+	0x68, 0x00, 0x69, 0x00, 0x6A, 0x00, 0x6B, 0x00, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0x6F, 0x00,
+	0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00,
+	0x78, 0x00, 0x79, 0x00, 0x7A, 0x00, 0x7B, 0x00, 0x7C, 0x00, 0x7D, 0x00, 0x7E, 0x00, 0xA0, 0x00,
+	0xA1, 0x00, 0xA2, 0x00, 0xA3, 0x00, 0xA5, 0x00, 0xA7, 0x00, 0xAA, 0x00, 0xAB, 0x00, 0xAC, 0x00,
+	0xB0, 0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB5, 0x00, 0xB6, 0x00, 0xB7, 0x00, 0xBA, 0x00, 0xBB, 0x00,
+	0xBC, 0x00, 0xBD, 0x00, 0xBF, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC9, 0x00,
+	0xD1, 0x00, 0xD6, 0x00, 0xDC, 0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE4, 0x00,
+	0xE5, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00,
+	0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF6, 0x00,
+	0xF7, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x92, 0x01, 0x93, 0x03,
+	0x98, 0x03, 0xA3, 0x03, 0xA6, 0x03, 0xA9, 0x03, 0xB1, 0x03, 0xB4, 0x03, 0xB5, 0x03, 0xC0, 0x03,
+	0xC3, 0x03, 0xC4, 0x03, 0xC6, 0x03, 0x22, 0x20, 0x3C, 0x20, 0x7F, 0x20, 0xA7, 0x20, 0x90, 0x21,
+	0x91, 0x21, 0x92, 0x21, 0x93, 0x21, 0x94, 0x21, 0x95, 0x21, 0xA8, 0x21, 0x19, 0x22, 0x1A, 0x22,
+	0x1E, 0x22, 0x1F, 0x22, 0x29, 0x22, 0x48, 0x22, 0x61, 0x22, 0x64, 0x22, 0x65, 0x22, 0x02, 0x23,
+	0x10, 0x23, 0x20, 0x23, 0x21, 0x23, 0x00, 0x25, 0x02, 0x25, 0x0C, 0x25, 0x10, 0x25, 0x14, 0x25,
+	0x18, 0x25, 0x1C, 0x25, 0x24, 0x25, 0x2C, 0x25, 0x34, 0x25, 0x3C, 0x25, 0x50, 0x25, 0x51, 0x25,
+	0x52, 0x25, 0x53, 0x25, 0x54, 0x25, 0x55, 0x25, 0x56, 0x25, 0x57, 0x25, 0x58, 0x25, 0x59, 0x25,
+	0x5A, 0x25, 0x5B, 0x25, 0x5C, 0x25, 0x5D, 0x25, 0x5E, 0x25, 0x5F, 0x25, 0x60, 0x25, 0x61, 0x25,
+	0x62, 0x25, 0x63, 0x25, 0x64, 0x25, 0x65, 0x25, 0x66, 0x25, 0x67, 0x25, 0x68, 0x25, 0x69, 0x25,
+	0x6A, 0x25, 0x6B, 0x25, 0x6C, 0x25, 0x80, 0x25, 0x84, 0x25, 0x88, 0x25, 0x8C, 0x25, 0x90, 0x25,
+	0x91, 0x25, 0x92, 0x25, 0xA0, 0x25, 0xAC, 0x25, 0xB2, 0x25, 0xBA, 0x25, 0xBC, 0x25, 0xC4, 0x25,
+	0xCB, 0x25, 0xD8, 0x25, 0xD9, 0x25, 0x3A, 0x26, 0x3B, 0x26, 0x3C, 0x26, 0x40, 0x26, 0x42, 0x26,
+	0x60, 0x26, 0x63, 0x26, 0x65, 0x26, 0x66, 0x26, 0x6A, 0x26, 0x6B, 0x26,
+	// glyph records - offset, width, x offset, advance
+	0x00, 0x00, 0, 0, 6, // U+0020
+	0x00, 0x00, 1, 2, 6, // U+0021
+	0x01, 0x00, 3, 1, 6, // U+0022
+	0x04, 0x00, 5, 0, 6, // U+0023
+	0x09, 0x00, 5, 0, 6, // U+0024
+	0x0E, 0x00, 5, 0, 6, // U+0025
+	0x13, 0x00, 5, 0, 6, // U+0026
+	0x18, 0x00, 3, 1, 6, // U+0027
+	0x1B, 0x00, 3, 1, 6, // U+0028
+	0x1E, 0x00, 3, 1, 6, // U+0029
+	0x21, 0x00, 5, 0, 6, // U+002A
+	0x26, 0x00, 5, 0, 6, // U+002B
+	0x2B, 0x00, 3, 1, 6, // U+002C
+	0x2E, 0x00, 5, 0, 6, // U+002D
+	0x33, 0x00, 2, 2, 6, // U+002E
+	0x35, 0x00, 5, 0, 6, // U+002F
+	0x3A, 0x00, 5, 0, 6, // U+0030
+	0x3F, 0x00, 3, 1, 6, // U+0031
+	0x42, 0x00, 5, 0, 6, // U+0032
+	0x47, 0x00, 5, 0, 6, // U+0033
+	0x4C, 0x00, 5, 0, 6, // U+0034
+	0x51, 0x00, 5, 0, 6, // U+0035
+	0x56, 0x00, 5, 0, 6, // U+0036
+	0x5B, 0x00, 5, 0, 6, // U+0037
+	0x60, 0x00, 5, 0, 6, // U+0038
+	0x65, 0x00, 5, 0, 6, // U+0039
+	0x6A, 0x00, 1, 2, 6, // U+003A
+	0x6B, 0x00, 2, 1, 6, // U+003B
+	0x6D, 0x00, 4, 1, 6, // U+003C
+	0x71, 0x00, 5, 0, 6, // U+003D
+	0x76, 0x00, 4, 1, 6, // U+003E
+	0x7A, 0x00, 5, 0, 6, // U+003F
+	0x7F, 0x00, 5, 0, 6, // U+0040
+	0x84, 0x00, 5, 0, 6, // U+0041
+	0x89, 0x00, 5, 0, 6, // U+0042
+	0x8E, 0x00, 5, 0, 6, // U+0043
+	0x93, 0x00, 5, 0, 6, // U+0044
+	0x98, 0x00, 5, 0, 6, // U+0045
+	0x9D, 0x00, 5, 0, 6, // U+0046
+	0xA2, 0x00, 5, 0, 6, // U+0047
+	0xA7, 0x00, 5, 0, 6, // U+0048
+	0xAC, 0x00, 3, 1, 6, // U+0049
+	0xAF, 0x00, 5, 0, 6, // U+004A
+	0xB4, 0x00, 5, 0, 6, // U+004B
+	0xB9, 0x00, 5, 0, 6, // U+004C
+	0xBE, 0x00, 5, 0, 6, // U+004D
+	0xC3, 0x00, 5, 0, 6, // U+004E
+	0xC8, 0x00, 5, 0, 6, // U+004F
+	0xCD, 0x00, 5, 0, 6, // U+0050
+	0xD2, 0x00, 5, 0, 6, // U+0051
+	0xD7, 0x00, 5, 0, 6, // U+0052
+	0xDC, 0x00, 5, 0, 6, // U+0053
+	0xE1, 0x00, 5, 0, 6, // U+0054
+	0xE6, 0x00, 5, 0, 6, // U+0055
+	0xEB, 0x00, 5, 0, 6, // U+0056
+	0xF0, 0x00, 5, 0, 6, // U+0057
+	0xF5, 0x00, 5, 0, 6, // U+0058
+	0xFA, 0x00, 5, 0, 6, // U+0059
+	0xFF, 0x00, 5, 0, 6, // U+005A
+	0x04, 0x01, 4, 1, 6, // U+005B
+	0x08, 0x01, 5, 0, 6, // U+005C
+	0x0D, 0x01, 4, 1, 6, // U+005D
+	0x11, 0x01, 5, 0, 6, // U+005E
+	0x16, 0x01, 5, 0, 6, // U+005F
+	0x1B, 0x01, 3, 1, 6, // U+0060
+	0x1E, 0x01, 5, 0, 6, // U+0061
+	0x23, 0x01, 5, 0, 6, // U+0062
+	0x28, 0x01, 5, 0, 6, // U+0063
+	0x2D, 0x01, 5, 0, 6, // U+0064
+	0x32, 0x01, 5, 0, 6, // U+0065
+	0x37, 0x01, 4, 1, 6, // U+0066
+	0x3B, 0x01, 5, 0, 6, // U+0067
+	0x40, 0x01, 5, 0, 6, // U+0068
+	0x45, 0x01, 3, 1, 6, // U+0069
+	0x48, 0x01, 4, 0, 6, // U+006A
+	0x4C, 0x01, 4, 0, 6, // U+006B
+	0x50, 0x01, 3, 1, 6, // U+006C
+	0x53, 0x01, 5, 0, 6, // U+006D
+	0x58, 0x01, 5, 0, 6, // U+006E
+	0x5D, 0x01, 5, 0, 6, // U+006F
+	0x62, 0x01, 5, 0, 6, // U+0070
+	0x67, 0x01, 5, 0, 6, // U+0071
+	0x6C, 0x01, 5, 0, 6, // U+0072
+	0x71, 0x01, 5, 0, 6, // U+0073
+	0x76, 0x01, 5, 0, 6, // U+0074
+	0x7B, 0x01, 5, 0, 6, // U+0075
+	0x80, 0x01, 5, 0, 6, // U+0076
+	0x85, 0x01, 5, 0, 6, // U+0077
+	0x8A, 0x01, 5, 0, 6, // U+0078
+	0x8F, 0x01, 5, 0, 6, // U+0079
+	0x94, 0x01, 5, 0, 6, // U+007A
+	0x99, 0x01, 3, 1, 6, // U+007B
+	0x9C, 0x01, 1, 2, 6, // U+007C
+	0x9D, 0x01, 3, 1, 6, // U+007D
+	0xA0, 0x01, 5, 0, 6, // U+007E
+	0x00, 0x00, 0, 0, 6, // U+00A0
+	0xA5, 0x01, 1, 2, 6, // U+00A1
+	0xA6, 0x01, 5, 0, 6, // U+00A2
+	0xAB, 0x01, 5, 0, 6, // U+00A3
+	0xB0, 0x01, 5, 0, 6, // U+00A5
+	0xB5, 0x01, 4, 1, 6, // U+00A7
+	0xB9, 0x01, 5, 0, 6, // U+00AA
+	0xBE, 0x01, 5, 0, 6, // U+00AB
+	0xC3, 0x01, 5, 0, 6, // U+00AC
+	0xC8, 0x01, 5, 0, 6, // U+00B0
+	0xCD, 0x01, 5, 0, 6, // U+00B1
+	0xD2, 0x01, 4, 1, 6, // U+00B2
+	0xD6, 0x01, 5, 0, 6, // U+00B5
+	0xDB, 0x01, 5, 0, 6, // U+00B6
+	0xE0, 0x01, 2, 2, 6, // U+00B7
+	0xE2, 0x01, 5, 0, 6, // U+00BA
+	0xE7, 0x01, 5, 0, 6, // U+00BB
+	0xEC, 0x01, 5, 0, 6, // U+00BC
+	0xF1, 0x01, 5, 0, 6, // U+00BD
+	0xF6, 0x01, 5, 0, 6, // U+00BF
+	0xFB, 0x01, 5, 0, 6, // U+00C4
+	0x00, 0x02, 5, 0, 6, // U+00C5
+	0x05, 0x02, 5, 0, 6, // U+00C6
+	0x0A, 0x02, 5, 0, 6, // U+00C7
+	0x0F, 0x02, 4, 0, 6, // U+00C9
+	0x13, 0x02, 5, 0, 6, // U+00D1
+	0x18, 0x02, 5, 0, 6, // U+00D6
+	0x1D, 0x02, 5, 0, 6, // U+00DC
+	0x22, 0x02, 5, 0, 6, // U+00DF
+	0x27, 0x02, 5, 0, 6, // U+00E0
+	0x2C, 0x02, 5, 0, 6, // U+00E1
+	0x31, 0x02, 5, 0, 6, // U+00E2
+	0x36, 0x02, 5, 0, 6, // U+00E4
+	0x3B, 0x02, 5, 0, 6, // U+00E5
+	0x40, 0x02, 5, 0, 6, // U+00E6
+	0x45, 0x02, 5, 0, 6, // U+00E7
+	0x4A, 0x02, 5, 0, 6, // U+00E8
+	0x4F, 0x02, 5, 0, 6, // U+00E9
+	0x54, 0x02, 5, 0, 6, // U+00EA
+	0x59, 0x02, 5, 0, 6, // U+00EB
+	0x5E, 0x02, 4, 1, 6, // U+00EC
+	0x62, 0x02, 3, 2, 6, // U+00ED
+	0x65, 0x02, 4, 1, 6, // U+00EE
+	0x69, 0x02, 3, 2, 6, // U+00EF
+	0x6C, 0x02, 4, 1, 6, // U+00F1
+	0x70, 0x02, 5, 0, 6, // U+00F2
+	0x75, 0x02, 5, 0, 6, // U+00F3
+	0x7A, 0x02, 5, 0, 6, // U+00F4
+	0x7F, 0x02, 5, 0, 6, // U+00F6
+	0x84, 0x02, 5, 0, 6, // U+00F7
+	0x89, 0x02, 5, 0, 6, // U+00F9
+	0x8E, 0x02, 5, 0, 6, // U+00FA
+	0x93, 0x02, 5, 0, 6, // U+00FB
+	0x98, 0x02, 5, 0, 6, // U+00FC
+	0x9D, 0x02, 4, 1, 6, // U+00FF
+	0xA1, 0x02, 5, 0, 6, // U+0192
+	0xA6, 0x02, 5, 0, 6, // U+0393
+	0xAB, 0x02, 5, 0, 6, // U+0398
+	0xB0, 0x02, 5, 0, 6, // U+03A3
+	0xB5, 0x02, 5, 0, 6, // U+03A6
+	0xBA, 0x02, 5, 0, 6, // U+03A9
+	0xBF, 0x02, 5, 0, 6, // U+03B1
+	0xC4, 0x02, 5, 0, 6, // U+03B4
+	0xC9, 0x02, 4, 0, 6, // U+03B5
+	0xCD, 0x02, 5, 0, 6, // U+03C0
+	0xD2, 0x02, 5, 0, 6, // U+03C3
+	0xD7, 0x02, 5, 0, 6, // U+03C4
+	0xDC, 0x02, 5, 0, 6, // U+03C6
+	0xE1, 0x02, 3, 1, 6, // U+2022
+	0xE4, 0x02, 5, 0, 6, // U+203C
+	0xE9, 0x02, 4, 1, 6, // U+207F
+	0xED, 0x02, 5, 0, 6, // U+20A7
+	0xF2, 0x02, 5, 0, 6, // U+2190
+	0xF7, 0x02, 5, 0, 6, // U+2191
+	0xFC, 0x02, 5, 0, 6, // U+2192
+	0x01, 0x03, 5, 0, 6, // U+2193
+	0x06, 0x03, 5, 0, 6, // U+2194
+	0x0B, 0x03, 5, 0, 6, // U+2195
+	0x10, 0x03, 5, 0, 6, // U+21A8
+	0x15, 0x03, 2, 2, 6, // U+2219
+	0x17, 0x03, 5, 0, 6, // U+221A
+	0x1C, 0x03, 5, 0, 6, // U+221E
+	0x21, 0x03, 5, 0, 6, // U+221F
+	0x26, 0x03, 5, 0, 6, // U+2229
+	0x2B, 0x03, 5, 0, 6, // U+2248
+	0x30, 0x03, 5, 0, 6, // U+2261
+	0x35, 0x03, 5, 0, 6, // U+2264
+	0x3A, 0x03, 5, 0, 6, // U+2265
+	0x3F, 0x03, 5, 0, 6, // U+2302
+	0x44, 0x03, 5, 0, 6, // U+2310
+	0x49, 0x03, 3, 2, 6, // U+2320
+	0x4C, 0x03, 3, 0, 6, // U+2321
+	0x4F, 0x03, 5, 0, 6, // U+2500
+	0x54, 0x03, 1, 3, 6, // U+2502
+	0x55, 0x03, 2, 3, 6, // U+250C
+	0x57, 0x03, 4, 0, 6, // U+2510
+	0x5B, 0x03, 2, 3, 6, // U+2514
+	0x5D, 0x03, 4, 0, 6, // U+2518
+	0x61, 0x03, 2, 3, 6, // U+251C
+	0x63, 0x03, 4, 0, 6, // U+2524
+	0x67, 0x03, 5, 0, 6, // U+252C
+	0x6C, 0x03, 5, 0, 6, // U+2534
+	0x71, 0x03, 5, 0, 6, // U+253C
+	0x71, 0x00, 5, 0, 6, // U+2550
+	0x76, 0x03, 3, 2, 6, // U+2551
+	0x79, 0x03, 2, 3, 6, // U+2552
+	0x7B, 0x03, 3, 2, 6, // U+2553
+	0x7E, 0x03, 3, 2, 6, // U+2554
+	0x81, 0x03, 4, 0, 6, // U+2555
+	0x85, 0x03, 5, 0, 6, // U+2556
+	0x8A, 0x03, 5, 0, 6, // U+2557
+	0x8F, 0x03, 2, 3, 6, // U+2558
+	0x91, 0x03, 3, 2, 6, // U+2559
+	0x94, 0x03, 3, 2, 6, // U+255A
+	0x97, 0x03, 4, 0, 6, // U+255B
+	0x9B, 0x03, 5, 0, 6, // U+255C
+	0xA0, 0x03, 5, 0, 6, // U+255D
+	0xA5, 0x03, 2, 3, 6, // U+255E
+	0x76, 0x03, 3, 2, 6, // U+255F
+	0xA7, 0x03, 3, 2, 6, // U+2560
+	0xAA, 0x03, 4, 0, 6, // U+2561
+	0xAE, 0x03, 5, 0, 6, // U+2562
+	0xB3, 0x03, 5, 0, 6, // U+2563
+	0xB8, 0x03, 5, 0, 6, // U+2564
+	0x85, 0x03, 5, 0, 6, // U+2565
+	0xBD, 0x03, 5, 0, 6, // U+2566
+	0xC2, 0x03, 5, 0, 6, // U+2567
+	0x9B, 0x03, 5, 0, 6, // U+2568
+	0xC7, 0x03, 5, 0, 6, // U+2569
+	0xCC, 0x03, 5, 0, 6, // U+256A
+	0xD1, 0x03, 5, 0, 6, // U+256B
+	0xD6, 0x03, 5, 0, 6, // U+256C
+	0xDB, 0x03, 5, 0, 6, // U+2580
+	0xE0, 0x03, 5, 0, 6, // U+2584
+	0xE5, 0x03, 5, 0, 6, // U+2588
+	0xEA, 0x03, 3, 0, 6, // U+258C
+	0xED, 0x03, 2, 3, 6, // U+2590
+	0xEF, 0x03, 5, 0, 6, // U+2591
+	0xF4, 0x03, 5, 0, 6, // U+2592
+	0xF9, 0x03, 4, 1, 6, // U+25A0
+	0xFD, 0x03, 5, 0, 6, // U+25AC
+	0x02, 0x04, 5, 0, 6, // U+25B2
+	0x07, 0x04, 5, 0, 6, // U+25BA
+	0x0C, 0x04, 5, 0, 6, // U+25BC
+	0x11, 0x04, 5, 0, 6, // U+25C4
+	0x16, 0x04, 3, 1, 6, // U+25CB
+	0x19, 0x04, 5, 0, 6, // U+25D8
+	0x1E, 0x04, 5, 0, 6, // U+25D9
+	0x23, 0x04, 5, 0, 6, // U+263A
+	0x28, 0x04, 5, 0, 6, // U+263B
+	0x2D, 0x04, 5, 0, 6, // U+263C
+	0x32, 0x04, 5, 0, 6, // U+2640
+	0x37, 0x04, 5, 0, 6, // U+2642
+	0x3C, 0x04, 5, 0, 6, // U+2660
+	0x41, 0x04, 5, 0, 6, // U+2663
+	0x46, 0x04, 5, 0, 6, // U+2665
+	0x4B, 0x04, 5, 0, 6, // U+2666
+	0x50, 0x04, 5, 0, 6, // U+266A
+	0x55, 0x04, 5, 0, 6, // U+266B
+	// glyph data
+	0x5F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24,
+	0x2A, 0x7F, 0x2A, 0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36,
+	0x49, 0x56, 0x20, 0x50, 0x08, 0x07, 0x03, 0x1C, 0x22, 0x41,
+	0x41, 0x22, 0x1C, 0x2A, 0x1C, 0x7F, 0x1C, 0x2A, 0x08, 0x08,
+	0x3E, 0x08, 0x08, 0x80, 0x70, 0x30, 0x08, 0x08, 0x08, 0x08,
+	0x08, 0x60, 0x60, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x51,
+	0x49, 0x45, 0x3E, 0x42, 0x7F, 0x40, 0x72, 0x49, 0x49, 0x49,
+	0x46, 0x21, 0x41, 0x49, 0x4D, 0x33, 0x18, 0x14, 0x12, 0x7F,
+	0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49,
+	0x31, 0x41, 0x21, 0x11, 0x09, 0x07, 0x36, 0x49, 0x49, 0x49,
+	0x36, 0x46, 0x49, 0x49, 0x29, 0x1E, 0x14, 0x40, 0x34, 0x08,
+	0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41, 0x22,
+	0x14, 0x08, 0x02, 0x01, 0x59, 0x09, 0x06, 0x3E, 0x41, 0x5D,
+	0x59, 0x4E, 0x7C, 0x12, 0x11, 0x12, 0x7C, 0x7F, 0x49, 0x49,
+	0x49, 0x36, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x7F, 0x41, 0x41,
+	0x41, 0x3E, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x7F, 0x09, 0x09,
+	0x09, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x73, 0x7F, 0x08, 0x08,
+	0x08, 0x7F, 0x41, 0x7F, 0x41, 0x20, 0x40, 0x41, 0x3F, 0x01,
+	0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40, 0x40, 0x40, 0x40,
+	0x7F, 0x02, 0x1C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F,
+	0x3E, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x09, 0x09, 0x09, 0x06,
+	0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29, 0x46,
+	0x26, 0x49, 0x49, 0x49, 0x32, 0x03, 0x01, 0x7F, 0x01, 0x03,
+	0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40, 0x20, 0x1F,
+	0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x14, 0x63,
+	0x03, 0x04, 0x78, 0x04, 0x03, 0x61, 0x59, 0x49, 0x4D, 0x43,
+	0x7F, 0x41, 0x41, 0x41, 0x02, 0x04, 0x08, 0x10, 0x20, 0x41,
+	0x41, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x03, 0x07, 0x08, 0x20, 0x54, 0x54, 0x78,
+	0x40, 0x7F, 0x28, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44,
+	0x28, 0x38, 0x44, 0x44, 0x28, 0x7F, 0x38, 0x54, 0x54, 0x54,
+	0x18, 0x08, 0x7E, 0x09, 0x02, 0x18, 0xA4, 0xA4, 0x9C, 0x78,
+	0x7F, 0x08, 0x04, 0x04, 0x78, 0x44, 0x7D, 0x40, 0x20, 0x40,
+	0x40, 0x3D, 0x7F, 0x10, 0x28, 0x44, 0x41, 0x7F, 0x40, 0x7C,
+	0x04, 0x78, 0x04, 0x78, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38,
+	0x44, 0x44, 0x44, 0x38, 0xFC, 0x18, 0x24, 0x24, 0x18, 0x18,
+	0x24, 0x24, 0x18, 0xFC, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x48,
+	0x54, 0x54, 0x54, 0x24, 0x04, 0x04, 0x3F, 0x44, 0x24, 0x3C,
+	0x40, 0x40, 0x20, 0x7C, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C,
+	0x40, 0x30, 0x40, 0x3C, 0x44, 0x28, 0x10, 0x28, 0x44, 0x4C,
+	0x90, 0x90, 0x90, 0x7C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x08,
+	0x36, 0x41, 0x77, 0x41, 0x36, 0x08, 0x02, 0x01, 0x02, 0x04,
+	0x02, 0x7B, 0x3C, 0x24, 0xFF, 0x24, 0x24, 0x48, 0x7E, 0x49,
+	0x43, 0x66, 0x2B, 0x2F, 0xFC, 0x2F, 0x2B, 0x66, 0x89, 0x95,
+	0x6A, 0x26, 0x29, 0x29, 0x2F, 0x28, 0x08, 0x14, 0x2A, 0x14,
+	0x22, 0x08, 0x08, 0x08, 0x08, 0x38, 0x06, 0x0F, 0x09, 0x0F,
+	0x06, 0x44, 0x44, 0x5F, 0x44, 0x44, 0x19, 0x1D, 0x17, 0x12,
+	0x40, 0x7E, 0x20, 0x1E, 0x20, 0x06, 0x09, 0x7F, 0x01, 0x7F,
+	0x10, 0x10, 0x26, 0x29, 0x29, 0x29, 0x26, 0x22, 0x14, 0x2A,
+	0x14, 0x08, 0x2F, 0x10, 0x28, 0x34, 0xFA, 0x2F, 0x10, 0xC8,
+	0xAC, 0xBA, 0x30, 0x48, 0x4D, 0x40, 0x20, 0xF0, 0x29, 0x24,
+	0x29, 0xF0, 0xF0, 0x28, 0x25, 0x28, 0xF0, 0x7C, 0x0A, 0x09,
+	0x7F, 0x49, 0x1E, 0xA1, 0xA1, 0x61, 0x12, 0x7C, 0x54, 0x55,
+	0x45, 0x7D, 0x0D, 0x19, 0x31, 0x7D, 0x39, 0x44, 0x44, 0x44,
+	0x39, 0x3D, 0x40, 0x40, 0x40, 0x3D, 0x7C, 0x2A, 0x2A, 0x3E,
+	0x14, 0x21, 0x55, 0x54, 0x78, 0x40, 0x20, 0x54, 0x54, 0x79,
+	0x41, 0x21, 0x55, 0x55, 0x79, 0x41, 0x21, 0x54, 0x54, 0x78,
+	0x41, 0x20, 0x54, 0x55, 0x79, 0x40, 0x20, 0x54, 0x54, 0x7C,
+	0x54, 0x0C, 0x1E, 0x52, 0x72, 0x12, 0x39, 0x55, 0x54, 0x54,
+	0x58, 0x38, 0x54, 0x54, 0x55, 0x59, 0x39, 0x55, 0x55, 0x55,
+	0x59, 0x39, 0x54, 0x54, 0x54, 0x59, 0x01, 0x45, 0x7C, 0x40,
+	0x44, 0x7D, 0x41, 0x02, 0x45, 0x7D, 0x42, 0x45, 0x7C, 0x41,
+	0x7A, 0x0A, 0x0A, 0x72, 0x32, 0x4A, 0x48, 0x48, 0x30, 0x30,
+	0x48, 0x48, 0x4A, 0x32, 0x32, 0x49, 0x49, 0x49, 0x32, 0x32,
+	0x48, 0x48, 0x48, 0x32, 0x08, 0x08, 0x6B, 0x6B, 0x08, 0x3A,
+	0x42, 0x40, 0x20, 0x78, 0x38, 0x40, 0x40, 0x22, 0x7A, 0x3A,
+	0x41, 0x41, 0x21, 0x7A, 0x3A, 0x40, 0x40, 0x20, 0x7A, 0x9D,
+	0xA0, 0xA0, 0x7D, 0xC0, 0x88, 0x7E, 0x09, 0x03, 0x7E, 0x02,
+	0x02, 0x06, 0x06, 0x1C, 0x2A, 0x49, 0x2A, 0x1C, 0x63, 0x55,
+	0x49, 0x41, 0x63, 0x99, 0xA5, 0xE7, 0xA5, 0x99, 0x4C, 0x72,
+	0x01, 0x72, 0x4C, 0x38, 0x44, 0x44, 0x38, 0x44, 0x30, 0x4A,
+	0x4D, 0x4D, 0x30, 0x3E, 0x49, 0x49, 0x49, 0x02, 0x7E, 0x02,
+	0x7E, 0x02, 0x38, 0x44, 0x44, 0x3C, 0x04, 0x06, 0x02, 0x7E,
+	0x02, 0x02, 0xBC, 0x62, 0x5A, 0x46, 0x3D, 0x18, 0x3C, 0x18,
+	0x5F, 0x5F, 0x00, 0x5F, 0x5F, 0x1F, 0x01, 0x01, 0x1E, 0xFF,
+	0x09, 0x29, 0xF6, 0x20, 0x08, 0x1C, 0x2A, 0x08, 0x08, 0x08,
+	0x04, 0x7E, 0x04, 0x08, 0x08, 0x08, 0x2A, 0x1C, 0x08, 0x10,
+	0x20, 0x7E, 0x20, 0x10, 0x0C, 0x1E, 0x0C, 0x1E, 0x0C, 0x14,
+	0x22, 0x7F, 0x22, 0x14, 0x94, 0xA2, 0xFF, 0xA2, 0x94, 0x18,
+	0x18, 0x30, 0x40, 0xFF, 0x01, 0x01, 0x30, 0x48, 0x78, 0x48,
+	0x30, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x7E, 0x01, 0x01, 0x01,
+	0x7E, 0x36, 0x12, 0x36, 0x24, 0x36, 0x2A, 0x2A, 0x2A, 0x2A,
+	0x2A, 0x40, 0x44, 0x4A, 0x51, 0x40, 0x40, 0x51, 0x4A, 0x44,
+	0x40, 0x3C, 0x26, 0x23, 0x26, 0x3C, 0x38, 0x08, 0x08, 0x08,
+	0x08, 0xFF, 0x01, 0x03, 0xE0, 0x80, 0xFF, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0xFF, 0xF0, 0x10, 0x10, 0x10, 0x10, 0xF0, 0x1F,
+	0x10, 0x10, 0x10, 0x10, 0x1F, 0xFF, 0x10, 0x10, 0x10, 0x10,
+	0xFF, 0x10, 0x10, 0x10, 0xF0, 0x10, 0x10, 0x10, 0x10, 0x1F,
+	0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0xFF, 0x00, 0xFF, 0xFC,
+	0x14, 0xF0, 0x10, 0xF0, 0xFC, 0x04, 0xF4, 0x14, 0x14, 0x14,
+	0xFC, 0x10, 0x10, 0xF0, 0x10, 0xF0, 0x14, 0x14, 0xF4, 0x04,
+	0xFC, 0x1F, 0x14, 0x1F, 0x10, 0x1F, 0x1F, 0x10, 0x17, 0x14,
+	0x14, 0x14, 0x1F, 0x10, 0x10, 0x1F, 0x10, 0x1F, 0x14, 0x14,
+	0x17, 0x10, 0x1F, 0xFF, 0x14, 0xFF, 0x00, 0xF7, 0x14, 0x14,
+	0x14, 0xFF, 0x10, 0x10, 0xFF, 0x00, 0xFF, 0x14, 0x14, 0xF7,
+	0x00, 0xFF, 0x14, 0x14, 0x14, 0xF4, 0x14, 0x14, 0x14, 0xF4,
+	0x04, 0xF4, 0x14, 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x17,
+	0x10, 0x17, 0x14, 0x14, 0x14, 0xFF, 0x14, 0x10, 0x10, 0xFF,
+	0x10, 0xFF, 0x14, 0x14, 0xF7, 0x00, 0xF7, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x55,
+	0x00, 0xAA, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x3C, 0x3C, 0x3C,
+	0x3C, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x38, 0x3E, 0x38,
+	0x30, 0x7F, 0x3E, 0x1C, 0x1C, 0x08, 0x06, 0x0E, 0x3E, 0x0E,
+	0x06, 0x08, 0x1C, 0x1C, 0x3E, 0x7F, 0x18, 0x24, 0x18, 0xFF,
+	0xE7, 0xC3, 0xE7, 0xFF, 0xFF, 0xE7, 0xDB, 0xE7, 0xFF, 0x3E,
+	0x5B, 0x4F, 0x5B, 0x3E, 0x3E, 0x6B, 0x4F, 0x6B, 0x3E, 0x5A,
+	0x3C, 0xE7, 0x3C, 0x5A, 0x26, 0x29, 0x79, 0x29, 0x26, 0x30,
+	0x48, 0x3A, 0x06, 0x0E, 0x1C, 0x5E, 0x7F, 0x5E, 0x1C, 0x1C,
+	0x57, 0x7D, 0x57, 0x1C, 0x1C, 0x3E, 0x7C, 0x3E, 0x1C, 0x18,
+	0x3C, 0x7E, 0x3C, 0x18, 0x40, 0x7F, 0x05, 0x05, 0x07, 0x40,
+	0x7F, 0x05, 0x25, 0x3F
+};
@@ -0,0 +1,89 @@
+/****************************************************************************** 
+fontlargenumber.h
+Definition for large font
+
+This file was imported from the MicroView library, written by GeekAmmo
+(https://github.com/geekammo/MicroView-Arduino-Library), and released under 
+the terms of the GNU General Public License as published by the Free Software 
+Foundation, either version 3 of the License, or (at your option) any later 
+version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Modified by:
+Emil Varughese @ Edwin Robotics Pvt. Ltd.
+July 27, 2015
+https://github.com/emil01/SparkFun_Micro_OLED_Arduino_Library/
+
+******************************************************************************/
+#pragma once
+
+// _fnt_largenum.h packed - created by tools/qwfont_pack.py
+//
+// 528 bytes, 792 bytes unpacked
+
+// Define the font attributes
+#define FONT_LARGENUM_RLE_WIDTH        12
+#define FONT_LARGENUM_RLE_HEIGHT       48
+#define FONT_LARGENUM_RLE_START        48
+#define FONT_LARGENUM_RLE_NCHAR        11
+#define FONT_LARGENUM_RLE_GLYPH_BYTES  66
+#define FONT_LARGENUM_RLE_NAME         "Large Number"
+
+// Glyph records and packed glyph data - see QwPackedFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t fontlargenum_rle_data[] = {
+#else
+	static const uint8_t fontlargenum_rle_data[] PROGMEM = {
+#endif
+	// glyph records - offset, width, x offset, advance
+	0x00, 0x00, 10, 0, 12, // '0'
+	0x3C, 0x00, 8, 2, 12, // '1'
+	0x5E, 0x00, 8, 1, 12, // '2'
+	0x84, 0x00, 8, 1, 12, // '3'
+	0xAD, 0x00, 11, 0, 12, // '4'
+	0xDD, 0x00, 8, 1, 12, // '5'
+	0x03, 0x01, 9, 1, 12, // '6'
+	0x37, 0x01, 9, 1, 12, // '7'
+	0x5B, 0x01, 9, 1, 12, // '8'
+	0x92, 0x01, 9, 1, 12, // '9'
+	0xC7, 0x01, 3, 4, 12, // ':'
+	// packed glyph data
+	0x0C, 0x00, 0xC0, 0xF8, 0x7C, 0x3E, 0x3E, 0xFC, 0xF8, 0xC0, 0x00, 0xF0, 0xFF, 0x0F, 0x81, 0x00,
+	0x0B, 0xF9, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x82, 0xFF, 0x0B,
+	0xC0, 0xFC, 0x7F, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x07, 0x81, 0x00, 0x0C, 0xFC,
+	0xFF, 0x07, 0x00, 0x03, 0x1F, 0x3F, 0x7C, 0x7C, 0x3F, 0x1F, 0x03, 0x00, 0x04, 0x80, 0xE0, 0x78,
+	0xFE, 0xFE, 0x81, 0x00, 0x04, 0x07, 0x03, 0x00, 0xFF, 0xFF, 0x84, 0x00, 0x80, 0xFF, 0x84, 0x00,
+	0x80, 0xFF, 0x84, 0x00, 0x80, 0xFF, 0x81, 0x00, 0x81, 0x7C, 0x80, 0x7F, 0x81, 0x7C, 0x08, 0xF0,
+	0x7C, 0x3C, 0x3E, 0x3E, 0xFE, 0xFC, 0xE0, 0x01, 0x83, 0x00, 0x80, 0xFF, 0x82, 0x00, 0x0E, 0xE0,
+	0xFE, 0x1F, 0x01, 0x00, 0x00, 0xE0, 0xFE, 0x0F, 0x01, 0x00, 0x00, 0xE0, 0xFE, 0x0F, 0x83, 0x00,
+	0x80, 0x7F, 0x84, 0x7C, 0x00, 0x7C, 0x81, 0x3E, 0x02, 0xFE, 0xF8, 0xC0, 0x84, 0x00, 0x80, 0xFF,
+	0x80, 0x00, 0x80, 0xF8, 0x02, 0xFC, 0xFF, 0xC7, 0x84, 0x00, 0x03, 0x01, 0x0F, 0xFF, 0xF8, 0x83,
+	0x00, 0x0A, 0xC0, 0xFF, 0x7F, 0x3F, 0x7E, 0x7C, 0x7C, 0x7E, 0x1F, 0x07, 0x00, 0x83, 0x00, 0x02,
+	0xF8, 0xFE, 0xFE, 0x84, 0x00, 0x04, 0xE0, 0xFF, 0x1F, 0xFF, 0xFF, 0x82, 0x00, 0x06, 0xC0, 0xFE,
+	0x3F, 0x03, 0x00, 0xFF, 0xFF, 0x81, 0x00, 0x02, 0xF8, 0xFF, 0xE7, 0x81, 0xE0, 0x80, 0xFF, 0x81,
+	0xE0, 0x84, 0x03, 0x80, 0xFF, 0x81, 0x03, 0x84, 0x00, 0x80, 0x7F, 0x81, 0x00, 0x80, 0xFE, 0x83,
+	0x3E, 0x02, 0x00, 0xFF, 0xFF, 0x84, 0x00, 0x80, 0x3F, 0x04, 0x3E, 0x7E, 0xFC, 0xF8, 0xE0, 0x84,
+	0x00, 0x02, 0x07, 0xFF, 0xFE, 0x83, 0x00, 0x0A, 0xC0, 0xFF, 0x7F, 0x1F, 0x3E, 0x7C, 0x7C, 0x3E,
+	0x1F, 0x07, 0x00, 0x03, 0x00, 0x80, 0xF0, 0xFC, 0x81, 0x3E, 0x04, 0xFC, 0x00, 0xE0, 0xFF, 0x3F,
+	0x84, 0x00, 0x80, 0xFF, 0x06, 0x80, 0xF0, 0x7C, 0x7C, 0xF8, 0xF0, 0x00, 0x81, 0xFF, 0x17, 0x03,
+	0x00, 0x00, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x03,
+	0x1F, 0x7F, 0x7C, 0x7C, 0x3F, 0x07, 0x00, 0x85, 0x3E, 0x80, 0xFE, 0x83, 0x00, 0x03, 0xC0, 0xFC,
+	0x7F, 0x03, 0x81, 0x00, 0x03, 0x80, 0xF8, 0xFF, 0x07, 0x82, 0x00, 0x02, 0xF0, 0xFF, 0x0F, 0x83,
+	0x00, 0x02, 0xFE, 0xFF, 0x03, 0x84, 0x00, 0x80, 0x7F, 0x84, 0x00, 0x0B, 0x00, 0xC0, 0xF8, 0xFE,
+	0x3E, 0x7E, 0xFC, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x81, 0x00, 0x80, 0xFF, 0x80, 0x00, 0x13, 0x01,
+	0x9F, 0xFF, 0xF8, 0xFE, 0x1F, 0x01, 0x00, 0xC0, 0xFC, 0x3F, 0x03, 0x03, 0x1F, 0xFF, 0xFC, 0xC0,
+	0xFF, 0xFF, 0x80, 0x81, 0x00, 0x0B, 0x80, 0xFF, 0xFF, 0x01, 0x1F, 0x3F, 0x7E, 0x7C, 0x7E, 0x3F,
+	0x1F, 0x01, 0x0B, 0x00, 0xE0, 0xFC, 0x7E, 0x3E, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xFF, 0x03, 0x81,
+	0x00, 0x80, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x80, 0x81, 0xFF, 0x08, 0x00, 0x0F,
+	0x1F, 0x3E, 0x3E, 0x0F, 0x01, 0xFF, 0xFF, 0x83, 0x00, 0x0C, 0x80, 0xFC, 0xFF, 0x07, 0x00, 0x3E,
+	0x7C, 0x7C, 0x7E, 0x3F, 0x0F, 0x01, 0x00, 0x05, 0xC0, 0xE0, 0xC0, 0x3F, 0x7F, 0x3F, 0x82, 0x00,
+	0x01, 0x80, 0x00, 0x81, 0xFF, 0x02, 0x00, 0x01, 0x00
+};
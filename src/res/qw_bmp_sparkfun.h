@@ -62,6 +62,9 @@ public:
         : bmpSingleton<QwBMPSparkFun>(BMP_SPARKFUN_WIDTH, BMP_SPARKFUN_HEIGHT)
     {
     }
+
+    // compile time attributes
+    typedef QwBitmapTraits<BMP_SPARKFUN_WIDTH, BMP_SPARKFUN_HEIGHT> traits;
 };
 
 #define QW_BMP_SPARKFUN QwBMPSparkFun::instance()
\ No newline at end of file
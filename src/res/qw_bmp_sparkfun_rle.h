@@ -0,0 +1,29 @@
+// qw_bmp_sparkfun_rle.h
+//
+// Run length encoded bitmap - created by tools/qwbitmap_rle.py from _bmp_sparkfun.h
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwBMPSparkFunRLE final : public bmpSingleton<QwBMPSparkFunRLE> {
+
+public:
+    const uint8_t* data(void)
+    {
+
+#include "_bmp_sparkfun_rle.h"
+
+        return bmp_sparkfun_rle_data;
+    }
+
+    QwBMPSparkFunRLE()
+        : bmpSingleton<QwBMPSparkFunRLE>(BMP_SPARKFUN_RLE_WIDTH, BMP_SPARKFUN_RLE_HEIGHT, grBitmapRLE)
+    {
+    }
+
+    // compile time attributes
+    typedef QwBitmapTraits<BMP_SPARKFUN_RLE_WIDTH, BMP_SPARKFUN_RLE_HEIGHT> traits;
+};
+
+#define QW_BMP_SPARKFUN_RLE QwBMPSparkFunRLE::instance()
@@ -62,6 +62,9 @@ public:
         : bmpSingleton<QwBMPTruck>(BMP_TRUCK_WIDTH, BMP_TRUCK_HEIGHT)
     {
     }
+
+    // compile time attributes
+    typedef QwBitmapTraits<BMP_TRUCK_WIDTH, BMP_TRUCK_HEIGHT> traits;
 };
 
 #define QW_BMP_TRUCK QwBMPTruck::instance()
\ No newline at end of file
@@ -69,6 +69,9 @@ public:
             FONT_31X48_NAME)
     {
     }
+
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_31X48_WIDTH, FONT_31X48_HEIGHT, FONT_31X48_START, FONT_31X48_NCHAR, FONT_31X48_MAP_WIDTH> traits;
 };
 
 #define QW_FONT_31X48 QwFont31x48::instance()
\ No newline at end of file
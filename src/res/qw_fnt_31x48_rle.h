@@ -0,0 +1,38 @@
+// qw_fnt_31x48_rle.h
+//
+// Packed version of the 31 x 48 font - created by tools/qwfont_pack.py from _fnt_31x48.h
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwFont31x48RLE final : public packedFontSingleton<QwFont31x48RLE> {
+
+public:
+    const uint8_t* data(void)
+    {
+        // include font data (static const), and attribute defines.
+        // Doing this here makes the data variable a static (aka only one instance ever)
+        // variable in this method.
+#include "_fnt_31x48_rle.h"
+
+        return font31x48_rle_data;
+    }
+
+    uint8_t* glyphBuffer(void)
+    {
+        static uint8_t buffer[FONT_31X48_RLE_GLYPH_BYTES];
+        return buffer;
+    }
+
+    QwFont31x48RLE()
+        : packedFontSingleton<QwFont31x48RLE>(FONT_31X48_RLE_WIDTH,
+            FONT_31X48_RLE_HEIGHT,
+            FONT_31X48_RLE_START,
+            FONT_31X48_RLE_NCHAR,
+            FONT_31X48_RLE_NAME)
+    {
+    }
+};
+
+#define QW_FONT_31X48_RLE QwFont31x48RLE::instance()
@@ -69,6 +69,9 @@ public:
             FONT_5X7_NAME)
     {
     }
+
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_5X7_WIDTH, FONT_5X7_HEIGHT, FONT_5X7_START, FONT_5X7_NCHAR, FONT_5X7_MAP_WIDTH> traits;
 };
 
 #define QW_FONT_5X7 QwFont5x7::instance()
\ No newline at end of file
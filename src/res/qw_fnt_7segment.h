@@ -69,6 +69,9 @@ public:
             FONT_7SEG_NAME)
     {
     }
+
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_7SEG_WIDTH, FONT_7SEG_HEIGHT, FONT_7SEG_START, FONT_7SEG_NCHAR, FONT_7SEG_MAP_WIDTH> traits;
 };
 
 #define QW_FONT_7SEGMENT QwFont7Segment::instance()
\ No newline at end of file
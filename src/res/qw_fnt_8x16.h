@@ -69,6 +69,9 @@ public:
             FONT_8X16_NAME)
     {
     }
+
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_8X16_WIDTH, FONT_8X16_HEIGHT, FONT_8X16_START, FONT_8X16_NCHAR, FONT_8X16_MAP_WIDTH> traits;
 };
 
 #define QW_FONT_8X16 QwFont8x16::instance()
\ No newline at end of file
@@ -69,6 +69,9 @@ public:
             FONT_LARGENUM_NAME)
     {
     }
+
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_LARGENUM_WIDTH, FONT_LARGENUM_HEIGHT, FONT_LARGENUM_START, FONT_LARGENUM_NCHAR, FONT_LARGENUM_MAP_WIDTH> traits;
 };
 
 #define QW_FONT_LARGENUM QwFontLargeNum::instance()
\ No newline at end of file
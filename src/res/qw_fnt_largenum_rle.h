@@ -0,0 +1,38 @@
+// qw_fnt_largenum_rle.h
+//
+// Packed version of the Large Number font - created by tools/qwfont_pack.py from _fnt_largenum.h
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwFontLargeNumRLE final : public packedFontSingleton<QwFontLargeNumRLE> {
+
+public:
+    const uint8_t* data(void)
+    {
+        // include font data (static const), and attribute defines.
+        // Doing this here makes the data variable a static (aka only one instance ever)
+        // variable in this method.
+#include "_fnt_largenum_rle.h"
+
+        return fontlargenum_rle_data;
+    }
+
+    uint8_t* glyphBuffer(void)
+    {
+        static uint8_t buffer[FONT_LARGENUM_RLE_GLYPH_BYTES];
+        return buffer;
+    }
+
+    QwFontLargeNumRLE()
+        : packedFontSingleton<QwFontLargeNumRLE>(FONT_LARGENUM_RLE_WIDTH,
+            FONT_LARGENUM_RLE_HEIGHT,
+            FONT_LARGENUM_RLE_START,
+            FONT_LARGENUM_RLE_NCHAR,
+            FONT_LARGENUM_RLE_NAME)
+    {
+    }
+};
+
+#define QW_FONT_LARGENUM_RLE QwFontLargeNumRLE::instance()
@@ -121,8 +121,30 @@
 //                      const uint8_t * pData = QW_BMP_TRUCK.data();
 //
 //  It shoulds complicated - it isn't. Just look at examples in ths folder and copy when
-//  adding new resources.
+//  adding new resources - or create them from BDF, PNG and PBM files with tools/qwresource.cpp
 //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Bitmap data formats
+//
+//      - Page - the layout of the graphics buffer. Each byte is 8 vertical pixels, bit 0 on
+//               top. The bitmap is (height + 7)/8 rows of width bytes. (default)
+//      - XBM  - row major. Each byte is 8 horizontal pixels, bit 0 on the left. Each row of
+//               pixels is (width + 7)/8 bytes. The layout of X11 bitmap (.xbm) files.
+//      - PBM  - row major, as XBM, but bit 7 is on the left. The layout of the data in binary
+//               portable bitmap (.pbm - P4) files.
+//      - RLE  - page layout data, run length encoded and stored in PROGMEM. The data is a
+//               stream of packets - each starts with a control byte:
+//                  0x00 - 0x7F  - (control + 1) literal bytes follow
+//                  0x80 - 0xFF  - the next byte is repeated (control - 0x80 + 2) times
+//               Runs can span bitmap rows. See tools/qwbitmap_rle.py to create these.
+
+typedef enum gr_bitmap_format_ {
+    grBitmapPage = 0,
+    grBitmapXBM = 1,
+    grBitmapPBM = 2,
+    grBitmapRLE = 3
+} grBitmapFormat_t;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Simple Bitmap class definition
 
@@ -131,16 +153,34 @@ class QwBitmap {
 public:
     uint8_t width;
     uint8_t height;
+    grBitmapFormat_t format;
     virtual const uint8_t* data(void) { return nullptr; };
 
 protected:
-    QwBitmap(uint8_t w, uint8_t h)
+    QwBitmap(uint8_t w, uint8_t h, grBitmapFormat_t fmt = grBitmapPage)
         : width { w }
         , height { h }
+        , format { fmt }
     {
     }
 };
 
+// Compile time bitmap attributes - a bitmap resource class names them with a traits typedef,
+// so sizes and layout math can be constant expressions:
+//
+//      typedef QwBitmapTraits<BMP_TRUCK_WIDTH, BMP_TRUCK_HEIGHT> traits;
+//
+//      uint8_t xCenter = (128 - QwBMPTruck::traits::width()) / 2;
+
+template <uint8_t W, uint8_t H>
+struct QwBitmapTraits {
+    static constexpr uint8_t width(void) { return W; }
+    static constexpr uint8_t height(void) { return H; }
+
+    // rows of page data - each 8 pixels high
+    static constexpr uint8_t nPages(void) { return (H + 7) / 8; }
+};
+
 // Template that creates a singleton for bitmaps.
 template <typename T>
 class bmpSingleton : public QwBitmap {
@@ -161,6 +201,28 @@ protected:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Font things - class to hold font attributes
+//
+// Text is drawn one glyph at a time. A glyph is the font data for a character - the
+// columns of the character, in the graphics buffer layout, and stored in PROGMEM. A glyph
+// is (height + 7)/8 rows of data, each row is width bytes.
+//
+// Placement of a glyph is relative to a "pen" position that moves along the string:
+//      - the glyph data is drawn xOffset pixels from the pen
+//      - the pen then moves by advance pixels, plus any kerning for the next character
+
+// The margin added after each glyph of a fixed width font. The 5x7 font - one row of font data -
+// has no margin in its glyphs, so one pixel is added. Taller fonts include the margin in their
+// glyphs. Used by every font that draws fixed width glyphs, so they space text the same.
+static constexpr uint8_t qwFontMargin(uint8_t height) { return height < 16 ? 1 : 0; }
+
+struct QwGlyph {
+    const uint8_t* pData; // glyph data (PROGMEM)
+    uint16_t stride; // bytes from one row of glyph data to the next
+    uint8_t width; // columns of glyph data
+    int8_t xOffset; // start of the glyph data, relative to the pen
+    uint8_t advance; // pen movement after the glyph
+    bool inRAM; // pData is in RAM - a glyph decoded by the font
+};
 
 class QwFont {
 
@@ -174,7 +236,46 @@ public:
 
     virtual const uint8_t* data(void) { return nullptr; };
 
+    // Return the glyph for a character - false if the font doesn't contain it. A missing
+    // character is returned as a blank glyph, a character cell wide.
+    //
+    // The default is a fixed width font - all characters are width pixels wide, and the
+    // font data is a map of character cells, map_width bytes wide.
+    virtual bool glyph(uint16_t code, QwGlyph& theGlyph)
+    {
+        if (code < start || code - start >= n_chars || !width)
+            return blankGlyph(theGlyph);
+
+        uint16_t offset = code - start;
+        uint8_t nRows = height > 8 ? height / 8 : 1;
+        uint16_t nRowLen = map_width / width; // characters in a row of font data
+
+        theGlyph.pData = data() + (offset / nRowLen * map_width * nRows) + (offset % nRowLen * width);
+        theGlyph.stride = map_width;
+        theGlyph.width = width;
+        theGlyph.xOffset = 0;
+        theGlyph.inRAM = false;
+
+        theGlyph.advance = width + qwFontMargin(height);
+
+        return true;
+    }
+
+    // Adjustment of the pen position between two characters - for kerning
+    virtual int8_t kerning(uint16_t left, uint16_t right) { return 0; }
+
 protected:
+    bool blankGlyph(QwGlyph& theGlyph)
+    {
+        theGlyph.pData = nullptr;
+        theGlyph.stride = 0;
+        theGlyph.width = 0;
+        theGlyph.xOffset = 0;
+        theGlyph.advance = width + qwFontMargin(height);
+        theGlyph.inRAM = false;
+        return false;
+    }
+
     QwFont(uint8_t w, uint8_t h, uint8_t st_chr, uint8_t n_chr, uint16_t m_w, const char* f_name)
         : width { w }
         , height { h }
@@ -186,6 +287,38 @@ protected:
     }
 };
 
+// Compile time attributes of a fixed width font - for text drawn with a font known at compile
+// time (see QwGrPageDevice::text<Font>()). The glyph lookup and geometry are constant
+// expressions, instead of font object fields read for each character.
+//
+// A fixed width font resource class names its attributes with a traits typedef:
+//
+//      typedef QwFontTraits<FONT_8X16_WIDTH, FONT_8X16_HEIGHT, FONT_8X16_START,
+//                           FONT_8X16_NCHAR, FONT_8X16_MAP_WIDTH> traits;
+
+template <uint8_t W, uint8_t H, uint8_t Start, uint8_t NChars, uint16_t MapWidth>
+struct QwFontTraits {
+    static constexpr uint8_t width(void) { return W; }
+    static constexpr uint8_t height(void) { return H; }
+    static constexpr uint8_t start(void) { return Start; }
+    static constexpr uint8_t nChars(void) { return NChars; }
+    static constexpr uint16_t mapWidth(void) { return MapWidth; }
+
+    // rows of font data - each 8 pixels high
+    static constexpr uint8_t nRows(void) { return H > 8 ? H / 8 : 1; }
+
+    // pen movement after a glyph - as QwFont::glyph()
+    static constexpr uint8_t advance(void) { return W + qwFontMargin(H); }
+
+    static constexpr bool contains(uint16_t code) { return code >= Start && code - Start < NChars; }
+
+    // offset of the glyph of a character in the font data - as QwFont::glyph()
+    static constexpr uint16_t glyphOffset(uint16_t code)
+    {
+        return (code - Start) / (MapWidth / W) * MapWidth * nRows() + (code - Start) % (MapWidth / W) * W;
+    }
+};
+
 // Template that creates a singleton for bitmaps.
 template <typename T>
 class fontSingleton : public QwFont {
@@ -203,3 +336,395 @@ protected:
     fontSingleton() { }
     using QwFont::QwFont; // inherit constructor
 };
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Text encoding
+//
+// Strings are UTF-8. Characters are returned as 16 bit codes (the Unicode Basic Multilingual
+// Plane) - characters beyond that are returned as U+FFFD, the replacement character.
+//
+// Bytes that aren't part of a valid UTF-8 sequence are returned as is - so strings written
+// for the 8 bit character set of a font (for example the symbols of the 5x7 font) still work.
+
+#define kCodeReplacement 0xFFFD
+
+// Return the character at pText, and move pText past it.
+static inline uint16_t qwNextCode(const char*& pText)
+{
+    const uint8_t* p = (const uint8_t*)pText;
+    uint8_t nCont;
+    uint32_t code;
+
+    if (p[0] < 0xC2 || p[0] > 0xF4) { // ASCII, or not a lead byte
+        pText++;
+        return p[0];
+    }
+    if (p[0] < 0xE0) {
+        nCont = 1;
+        code = p[0] & 0x1F;
+    } else if (p[0] < 0xF0) {
+        nCont = 2;
+        code = p[0] & 0x0F;
+    } else {
+        nCont = 3;
+        code = p[0] & 0x07;
+    }
+    for (uint8_t i = 1; i <= nCont; i++) {
+        if ((p[i] & 0xC0) != 0x80) { // truncated sequence - take the lead byte as is
+            pText++;
+            return p[0];
+        }
+        code = code << 6 | (p[i] & 0x3F);
+    }
+    pText += nCont + 1;
+
+    // overlong three and four byte sequences and surrogates aren't characters
+    if (code > 0xFFFF || (nCont == 2 && code < 0x800) || (nCont == 3 && code < 0x10000) ||
+        (code >= 0xD800 && code <= 0xDFFF))
+        return kCodeReplacement;
+
+    return code;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Proportional fonts
+//
+// Each glyph of a proportional font has its own width, offset and advance - and the font can
+// have kerning pairs that adjust the spacing of specific character pairs.
+//
+// The font data (PROGMEM) is three tables, one after the other:
+//
+//      - Glyph records - n_chars records, one for each character from start:
+//              offset   - 2 bytes (LSB first) - offset of the glyph in the bitmap table
+//              width    - columns of glyph data - 0 for a blank glyph (space)
+//              xOffset  - signed offset of the glyph data from the pen position
+//              advance  - pen movement after the glyph
+//
+//      - Kerning pairs - n_kerning records, sorted by left, then right character:
+//              left     - 2 bytes (LSB first)
+//              right    - 2 bytes (LSB first)
+//              adjust   - signed adjustment of the pen before the right character
+//
+//      - Bitmap table - the glyph data. Each glyph is (height + 7)/8 rows of width bytes.
+//
+// The width attribute of a proportional font is the width of its widest glyph.
+
+#define kPropFontGlyphBytes 5
+#define kPropFontKernBytes 5
+
+class QwPropFont : public QwFont {
+
+public:
+    uint16_t n_kerning;
+
+    bool glyph(uint16_t code, QwGlyph& theGlyph)
+    {
+        if (code < start || code - start >= n_chars)
+            return blankGlyph(theGlyph);
+
+        return glyphRecord(code - start, theGlyph);
+    }
+
+    // Binary search of the kerning pairs
+    int8_t kerning(uint16_t left, uint16_t right)
+    {
+        const uint8_t* pKern = data() + m_recordOffset + m_nGlyphs * kPropFontGlyphBytes;
+        const uint8_t* pPair;
+        uint32_t key = (uint32_t)left << 16 | right;
+        uint32_t pair;
+        int16_t low = 0, high = n_kerning - 1, mid;
+
+        while (low <= high) {
+            mid = (low + high) / 2;
+            pPair = pKern + mid * kPropFontKernBytes;
+
+            pair = (uint32_t)(pgm_read_byte(pPair) | pgm_read_byte(pPair + 1) << 8) << 16
+                | (pgm_read_byte(pPair + 2) | pgm_read_byte(pPair + 3) << 8);
+
+            if (pair == key)
+                return (int8_t)pgm_read_byte(pPair + 4);
+
+            if (pair < key)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+        return 0;
+    }
+
+protected:
+    // The glyph for the given glyph record
+    bool glyphRecord(uint16_t index, QwGlyph& theGlyph)
+    {
+        const uint8_t* pRecord = data() + m_recordOffset + index * kPropFontGlyphBytes;
+
+        uint16_t offset = pgm_read_byte(pRecord) | pgm_read_byte(pRecord + 1) << 8;
+
+        theGlyph.width = pgm_read_byte(pRecord + 2);
+        theGlyph.xOffset = (int8_t)pgm_read_byte(pRecord + 3);
+        theGlyph.advance = pgm_read_byte(pRecord + 4);
+        theGlyph.stride = theGlyph.width;
+        theGlyph.inRAM = false;
+        theGlyph.pData = data() + m_recordOffset + m_nGlyphs * kPropFontGlyphBytes + n_kerning * kPropFontKernBytes
+            + offset;
+
+        return true;
+    }
+
+    QwPropFont(uint8_t w, uint8_t h, uint8_t st_chr, uint8_t n_chr, uint16_t n_kern, const char* f_name)
+        : QwFont(w, h, st_chr, n_chr, 0, f_name)
+        , n_kerning { n_kern }
+        , m_nGlyphs { n_chr }
+        , m_recordOffset { 0 }
+    {
+    }
+
+    uint16_t m_nGlyphs; // number of glyph records
+    uint16_t m_recordOffset; // bytes of font data before the glyph records
+};
+
+// Template that creates a singleton for proportional fonts.
+template <typename T>
+class propFontSingleton : public QwPropFont {
+public:
+    static T& instance(void)
+    {
+        static T instance;
+        return instance;
+    }
+
+    propFontSingleton(const propFontSingleton&) = delete;
+    propFontSingleton& operator=(const propFontSingleton) = delete;
+
+protected:
+    propFontSingleton() { }
+    using QwPropFont::QwPropFont; // inherit constructor
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Packed fonts
+//
+// A proportional font with the data of each glyph run length encoded - for the large fonts,
+// which are mostly runs of 0x00 and 0xFF. The tables are those of a proportional font, with
+// the offset of a glyph record giving the start of its packed data. Each glyph is packed on
+// its own, using the packets of RLE bitmaps (see grBitmapRLE), so any glyph can be decoded
+// without touching the others.
+//
+// A glyph is decoded when it's requested, into a RAM buffer provided by the font resource
+// class - glyphBuffer() - that holds the largest glyph. The last glyph decoded is kept, so a
+// repeated character isn't decoded again.
+//
+// See tools/qwfont_pack.py to create these fonts from the fixed width fonts of the library.
+
+class QwPackedFont : public QwPropFont {
+
+public:
+    bool glyph(uint16_t code, QwGlyph& theGlyph)
+    {
+        if (!QwPropFont::glyph(code, theGlyph))
+            return false;
+
+        if (!theGlyph.width) // blank - nothing to decode
+            return true;
+
+        uint8_t* pBuffer = glyphBuffer();
+        if (!pBuffer)
+            return blankGlyph(theGlyph);
+
+        if (code != m_decoded) {
+            const uint8_t* pPacked = theGlyph.pData;
+            uint16_t size = theGlyph.width * (height > 8 ? height / 8 : 1);
+            uint16_t n = 0;
+            uint8_t control, count, value;
+
+            while (n < size) {
+                control = pgm_read_byte(pPacked++);
+                if (control & 0x80) {
+                    value = pgm_read_byte(pPacked++);
+                    for (count = (control & 0x7F) + 2; count && n < size; count--)
+                        pBuffer[n++] = value;
+                } else {
+                    for (count = control + 1; count && n < size; count--)
+                        pBuffer[n++] = pgm_read_byte(pPacked++);
+                }
+            }
+            m_decoded = code;
+        }
+        theGlyph.pData = pBuffer;
+        theGlyph.inRAM = true;
+
+        return true;
+    }
+
+    // RAM for the decoded glyph - (height + 7)/8 * width bytes. Provided by the font resource
+    virtual uint8_t* glyphBuffer(void) { return nullptr; };
+
+protected:
+    QwPackedFont(uint8_t w, uint8_t h, uint8_t st_chr, uint8_t n_chr, const char* f_name)
+        : QwPropFont(w, h, st_chr, n_chr, 0, f_name)
+        , m_decoded { 0 }
+    {
+    }
+
+    uint16_t m_decoded; // code of the glyph in the buffer - 0 for none
+};
+
+// Template that creates a singleton for packed fonts.
+template <typename T>
+class packedFontSingleton : public QwPackedFont {
+public:
+    static T& instance(void)
+    {
+        static T instance;
+        return instance;
+    }
+
+    packedFontSingleton(const packedFontSingleton&) = delete;
+    packedFontSingleton& operator=(const packedFontSingleton) = delete;
+
+protected:
+    packedFontSingleton() { }
+    using QwPackedFont::QwPackedFont; // inherit constructor
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Subset fonts
+//
+// A fixed width font cut down to the characters an application uses - for example the digits
+// and colon of a clock in a large font. Text is drawn, and measured, the same as with the full
+// font. See tools/qwfont_subset.py to create these fonts from the fixed width fonts of the
+// library.
+//
+// The font data (PROGMEM) is two tables, one after the other:
+//
+//      - Remap table - n_chars bytes, one for each character from start: the cell of the
+//                      character's glyph in the font map, or kSubsetFontNoGlyph
+//      - Font map    - the glyphs in the subset, as the font map of a fixed width font with
+//                      one row of n_glyphs cells (map_width is n_glyphs * width)
+
+#define kSubsetFontNoGlyph 0xFF
+
+class QwSubsetFont : public QwFont {
+
+public:
+    uint8_t n_glyphs;
+
+    bool glyph(uint16_t code, QwGlyph& theGlyph)
+    {
+        if (code < start || code - start >= n_chars)
+            return blankGlyph(theGlyph);
+
+        uint8_t cell = pgm_read_byte(data() + code - start);
+        if (cell == kSubsetFontNoGlyph)
+            return blankGlyph(theGlyph);
+
+        theGlyph.pData = data() + n_chars + cell * width;
+        theGlyph.stride = map_width;
+        theGlyph.width = width;
+        theGlyph.xOffset = 0;
+        theGlyph.inRAM = false;
+
+        // as the full font
+        theGlyph.advance = width + qwFontMargin(height);
+
+        return true;
+    }
+
+protected:
+    QwSubsetFont(uint8_t w, uint8_t h, uint8_t st_chr, uint8_t n_chr, uint8_t n_glyph, const char* f_name)
+        : QwFont(w, h, st_chr, n_chr, n_glyph * w, f_name)
+        , n_glyphs { n_glyph }
+    {
+    }
+};
+
+// Template that creates a singleton for subset fonts.
+template <typename T>
+class subsetFontSingleton : public QwSubsetFont {
+public:
+    static T& instance(void)
+    {
+        static T instance;
+        return instance;
+    }
+
+    subsetFontSingleton(const subsetFontSingleton&) = delete;
+    subsetFontSingleton& operator=(const subsetFontSingleton) = delete;
+
+protected:
+    subsetFontSingleton() { }
+    using QwSubsetFont::QwSubsetFont; // inherit constructor
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Sparse fonts
+//
+// A proportional font for a set of characters that isn't a contiguous range - for example
+// Latin-1 plus a few symbols, or Cyrillic. The font data is the tables of a proportional font,
+// with a table of the character codes of the glyphs in front:
+//
+//      - Character codes - n_glyphs codes, 2 bytes each (LSB first), in ascending order. The
+//                          glyph records follow in the same order.
+//
+// A glyph is found with a binary search of the codes - so only the characters used are
+// stored, and lookup is O(log n) in PROGMEM. For a sparse font start is 0 and n_chars is
+// the number of glyphs (limited to 255) - n_glyphs is the count.
+
+#define kSparseFontCodeBytes 2
+
+class QwSparseFont : public QwPropFont {
+
+public:
+    uint16_t n_glyphs;
+
+    bool glyph(uint16_t code, QwGlyph& theGlyph)
+    {
+        const uint8_t* pCodes = data();
+        const uint8_t* pCode;
+        uint16_t value;
+        int16_t low = 0, high = n_glyphs - 1, mid;
+
+        while (low <= high) {
+            mid = (low + high) / 2;
+            pCode = pCodes + mid * kSparseFontCodeBytes;
+
+            value = pgm_read_byte(pCode) | pgm_read_byte(pCode + 1) << 8;
+
+            if (value == code)
+                return glyphRecord(mid, theGlyph);
+
+            if (value < code)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+        return blankGlyph(theGlyph);
+    }
+
+protected:
+    QwSparseFont(uint8_t w, uint8_t h, uint16_t n_glyph, uint16_t n_kern, const char* f_name)
+        : QwPropFont(w, h, 0, n_glyph > 255 ? 255 : n_glyph, n_kern, f_name)
+        , n_glyphs { n_glyph }
+    {
+        m_nGlyphs = n_glyph;
+        m_recordOffset = n_glyph * kSparseFontCodeBytes;
+    }
+};
+
+// Template that creates a singleton for sparse fonts.
+template <typename T>
+class sparseFontSingleton : public QwSparseFont {
+public:
+    static T& instance(void)
+    {
+        static T instance;
+        return instance;
+    }
+
+    sparseFontSingleton(const sparseFontSingleton&) = delete;
+    sparseFontSingleton& operator=(const sparseFontSingleton) = delete;
+
+protected:
+    sparseFontSingleton() { }
+    using QwSparseFont::QwSparseFont; // inherit constructor
+};
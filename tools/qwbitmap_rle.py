@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+#
+# qwbitmap_rle.py
+#
+# This is a tool for the SparkFun Qwiic OLED Arduino Library.
+#
+# Creates a run length encoded (RLE) bitmap resource for the library from a
+# portable bitmap file (.pbm - P1 or P4), or from an existing, uncompressed
+# bitmap resource data header (for example src/res/_bmp_sparkfun.h).
+#
+# Two files are written to the output directory, following the layout of the
+# resources in src/res:
+#
+#       _bmp_<name>_rle.h   - the compressed data, in PROGMEM, and size defines
+#       qw_bmp_<name>_rle.h - the bitmap object. Use QW_BMP_<NAME>_RLE in a sketch
+#
+# Usage:
+#       python3 qwbitmap_rle.py <input file> <name> [-o directory]
+#
+# The name is used for the file names and defines (lower/upper case) and for the
+# class name - for example sparkfun creates QwBMPSparkFunRLE. A name that matches the
+# class of the source resource keeps its capitals (QwBMPSparkFun, in qw_bmp_sparkfun.h),
+# so the resources of the library are reproduced exactly.
+#
+# The encoded format is described in src/res/qwiic_resdef.h.
+#
+# Repository:
+#     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+#
+# SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+#
+# SPDX-License-Identifier: MIT
+#
+#    The MIT License (MIT)
+#
+#    Copyright (c) 2022 SparkFun Electronics
+#    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+#    associated documentation files (the "Software"), to deal in the Software without restriction,
+#    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+#    do so, subject to the following conditions:
+#    The above copyright notice and this permission notice shall be included in all copies or substantial
+#    portions of the Software.
+#    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+#    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+#    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+#    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+#    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+import argparse
+import os
+import re
+import sys
+
+# Packet limits - see qwiic_resdef.h
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+
+
+def class_name(name, source):
+    """Class name part from a resource name - clock_digits -> ClockDigits. The capitals of
+    the class of the source resource (qw_*.h beside the data header) are kept if the name
+    matches it - sparkfun from _bmp_sparkfun.h -> SparkFun"""
+    default = "".join(part[:1].upper() + part[1:] for part in name.split("_"))
+
+    object_header = os.path.join(os.path.dirname(source), "qw" + os.path.basename(source))
+    if os.path.basename(source).startswith("_") and os.path.exists(object_header):
+        with open(object_header) as f:
+            match = re.search(r"^class\s+Qw(?:BMP|Font)(\w+)", f.read(), flags=re.M)
+        if match and match.group(1).lower() == default.lower():
+            return match.group(1)
+
+    return default
+
+
+def read_pbm(path):
+    """Read a P1 or P4 pbm file - returns width, height and rows of pixels (1 = on)"""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    # header tokens - magic, width, height - skipping comments
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos].decode("ascii"))
+
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+
+    if magic == "P4":
+        pos += 1  # single whitespace before the raster
+        stride = (width + 7) // 8
+        rows = []
+        for y in range(height):
+            line = data[pos + y * stride:pos + (y + 1) * stride]
+            rows.append([(line[x // 8] >> (7 - x % 8)) & 1 for x in range(width)])
+    elif magic == "P1":
+        bits = [int(c) for c in data[pos:].decode("ascii") if c in "01"]
+        rows = [bits[y * width:(y + 1) * width] for y in range(height)]
+    else:
+        sys.exit("Unsupported pbm format: " + magic)
+
+    return width, height, rows
+
+
+def pixels_to_pages(width, height, rows):
+    """Convert rows of pixels to the graphics buffer (page) layout"""
+    pages = []
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            value = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and rows[y][x]:
+                    value |= 1 << bit
+            pages.append(value)
+    return pages
+
+
+def read_resource(path):
+    """Read a library bitmap data header - the _WIDTH and _HEIGHT defines and the data array"""
+    with open(path) as f:
+        text = f.read()
+
+    # ignore commented out blocks
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+
+    width = int(re.search(r"#define\s+\w+_WIDTH\s+(\d+)", text).group(1))
+    height = int(re.search(r"#define\s+\w+_HEIGHT\s+(\d+)", text).group(1))
+    body = re.search(r"\{(.*?)\}", text, flags=re.S).group(1)
+    body = re.sub(r"//.*", "", body)
+    data = [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", body)]
+
+    return width, height, data
+
+
+def encode(data):
+    """Run length encode the data"""
+    out = []
+    literals = []
+
+    def flush():
+        if literals:
+            out.append(len(literals) - 1)
+            out.extend(literals)
+            del literals[:]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < MAX_REPEAT and data[i + run] == data[i]:
+            run += 1
+
+        # a run of 2 only pays off if it doesn't split a literal packet
+        if run >= 3 or (run == 2 and not literals):
+            flush()
+            out.append(0x80 | (run - 2))
+            out.append(data[i])
+            i += run
+        else:
+            literals.append(data[i])
+            if len(literals) == MAX_LITERAL:
+                flush()
+            i += 1
+    flush()
+
+    return out
+
+
+def decode(data, size):
+    """Decode - used to verify the encoded data"""
+    out = []
+    pos = 0
+    while len(out) < size:
+        control = data[pos]
+        pos += 1
+        if control & 0x80:
+            out.extend([data[pos]] * ((control & 0x7F) + 2))
+            pos += 1
+        else:
+            out.extend(data[pos:pos + control + 1])
+            pos += control + 1
+    return out
+
+
+DATA_HEADER = """// _bmp_{name}_rle.h
+//
+// Run length encoded bitmap - created by tools/qwbitmap_rle.py from {source}
+//
+// {size} bytes, {raw} bytes uncompressed
+
+#pragma once
+
+#define BMP_{NAME}_RLE_WIDTH  {width}
+#define BMP_{NAME}_RLE_HEIGHT {height}
+
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t bmp_{name}_rle_data[] = {{
+#else
+	static const uint8_t bmp_{name}_rle_data[] PROGMEM = {{
+#endif
+{data}
+}};
+"""
+
+OBJECT_HEADER = """// qw_bmp_{name}_rle.h
+//
+// Run length encoded bitmap - created by tools/qwbitmap_rle.py from {source}
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwBMP{Class}RLE final : public bmpSingleton<QwBMP{Class}RLE> {{
+
+public:
+    const uint8_t* data(void)
+    {{
+
+#include "_bmp_{name}_rle.h"
+
+        return bmp_{name}_rle_data;
+    }}
+
+    QwBMP{Class}RLE()
+        : bmpSingleton<QwBMP{Class}RLE>(BMP_{NAME}_RLE_WIDTH, BMP_{NAME}_RLE_HEIGHT, grBitmapRLE)
+    {{
+    }}
+
+    // compile time attributes
+    typedef QwBitmapTraits<BMP_{NAME}_RLE_WIDTH, BMP_{NAME}_RLE_HEIGHT> traits;
+}};
+
+#define QW_BMP_{NAME}_RLE QwBMP{Class}RLE::instance()
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create a run length encoded bitmap for the SparkFun Qwiic OLED library")
+    parser.add_argument("source", help="PBM file, or bitmap data header - for example src/res/_bmp_sparkfun.h")
+    parser.add_argument("name", help="resource name")
+    parser.add_argument("-o", dest="out_dir", default=".", help="output directory")
+    args = parser.parse_args()
+
+    source = args.source
+    name = args.name.lower()
+
+    if source.lower().endswith(".pbm"):
+        width, height, rows = read_pbm(source)
+        data = pixels_to_pages(width, height, rows)
+    else:
+        width, height, data = read_resource(source)
+
+    if width > 255 or height > 255:
+        sys.exit("Bitmaps are limited to 255 x 255 pixels")
+
+    raw = width * ((height + 7) // 8)
+    if len(data) < raw:
+        sys.exit("Not enough bitmap data - expected {} bytes".format(raw))
+    data = data[:raw]
+
+    encoded = encode(data)
+    if decode(encoded, raw) != data:
+        sys.exit("Internal error - encoded data doesn't match")
+
+    lines = []
+    for i in range(0, len(encoded), 16):
+        lines.append("    " + ", ".join("0x{:02X}".format(v) for v in encoded[i:i + 16]) + ",")
+
+    fields = {
+        "name": name,
+        "NAME": name.upper(),
+        "Class": class_name(args.name, source),
+        "source": os.path.basename(source),
+        "width": width,
+        "height": height,
+        "size": len(encoded),
+        "raw": raw,
+        "data": "\n".join(lines),
+    }
+
+    with open(os.path.join(args.out_dir, "_bmp_{}_rle.h".format(name)), "w") as f:
+        f.write(DATA_HEADER.format(**fields))
+
+    with open(os.path.join(args.out_dir, "qw_bmp_{}_rle.h".format(name)), "w") as f:
+        f.write(OBJECT_HEADER.format(**fields))
+
+    print("{}: {} x {}, {} bytes -> {} bytes".format(name, width, height, raw, len(encoded)))
+
+
+if __name__ == "__main__":
+    main()
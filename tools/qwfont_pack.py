@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+#
+# qwfont_pack.py
+#
+# This is a tool for the SparkFun Qwiic OLED Arduino Library.
+#
+# Creates a packed font resource for the library from the data header of a fixed
+# width font (for example src/res/_fnt_31x48.h). Empty columns are trimmed from each
+# glyph, and the data of each glyph is run length encoded on its own - so the font
+# can decode any glyph when it is drawn. The text drawn is the same as the source font.
+#
+# Two files are written to the output directory, following the layout of the
+# resources in src/res:
+#
+#       _fnt_<name>_rle.h   - the packed font tables, in PROGMEM, and the font defines
+#       qw_fnt_<name>_rle.h - the font object. Use QW_FONT_<NAME>_RLE in a sketch
+#
+# Usage:
+#       python3 qwfont_pack.py <font data header> <name> [-o directory]
+#
+# The name is used for the file names and defines (lower/upper case) and for the
+# class name - for example 31x48 creates QwFont31x48RLE. A name that matches the class
+# of the source font keeps its capitals (largenum creates QwFontLargeNumRLE), as
+# qwbitmap_rle.py.
+#
+# The packed font format is described in src/res/qwiic_resdef.h (QwPackedFont). The
+# run length encoding is the same as bitmaps - see qwbitmap_rle.py.
+#
+# Repository:
+#     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+#
+# SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+#
+# SPDX-License-Identifier: MIT
+#
+#    The MIT License (MIT)
+#
+#    Copyright (c) 2022 SparkFun Electronics
+#    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+#    associated documentation files (the "Software"), to deal in the Software without restriction,
+#    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+#    do so, subject to the following conditions:
+#    The above copyright notice and this permission notice shall be included in all copies or substantial
+#    portions of the Software.
+#    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+#    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+#    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+#    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+#    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+import argparse
+import os
+import re
+import sys
+
+from qwbitmap_rle import class_name, encode, decode
+
+GLYPH_RECORD_BYTES = 5
+
+
+def read_font(path):
+    """Read a library font data header - the comment header, font defines and the data array"""
+    with open(path) as f:
+        text = f.read()
+
+    header = text[:text.index("#pragma once")]
+
+    def define(attr):
+        return re.search(r"#define\s+\w+_" + attr + r"\s+(.+)", text).group(1).strip()
+
+    font = {
+        "header": header,
+        "width": int(define("WIDTH")),
+        "height": int(define("HEIGHT")),
+        "start": int(define("START")),
+        "n_chars": int(define("NCHAR")),
+        "map_width": int(define("MAP_WIDTH")),
+        "name": define("NAME").strip('"'),
+    }
+
+    # the data array - the last declaration, ignoring comments
+    body = text[text.rindex("= {") + 3:]
+    body = body[:body.index("}")]
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    body = re.sub(r"//.*", "", body)
+    font["data"] = [int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", body)]
+
+    return font
+
+
+def glyph_rows(font, index):
+    """The rows of font data of a glyph - from the font map, as QwFont::glyph() does"""
+    width, map_width = font["width"], font["map_width"]
+    n_rows = font["height"] // 8 if font["height"] > 8 else 1
+    row_len = map_width // width
+    base = index // row_len * map_width * n_rows + index % row_len * width
+
+    return [font["data"][base + row * map_width:base + row * map_width + width] for row in range(n_rows)]
+
+
+def pack(font):
+    """Trim and encode each glyph - returns the glyph records and the packed data"""
+    n_rows = font["height"] // 8 if font["height"] > 8 else 1
+    advance = font["width"] + (n_rows == 1)  # the 5x7 font margin, as QwFont::glyph()
+
+    records = []
+    packed = []
+    for index in range(font["n_chars"]):
+        rows = glyph_rows(font, index)
+        used = [x for x in range(font["width"]) if any(row[x] for row in rows)]
+
+        if not used:
+            records.append((len(packed), 0, 0, advance))
+            continue
+
+        x0, x1 = used[0], used[-1]
+        data = [v for row in rows for v in row[x0:x1 + 1]]
+        encoded = encode(data)
+        if decode(encoded, len(data)) != data:
+            sys.exit("Internal error - encoded data doesn't match")
+
+        records.append((len(packed), x1 - x0 + 1, x0, advance))
+        packed.extend(encoded)
+
+    if len(packed) > 0xFFFF:
+        sys.exit("Packed font data is over 64k bytes")
+
+    glyph_bytes = max(r[1] for r in records) * n_rows
+    return records, packed, glyph_bytes
+
+
+DATA_HEADER = """{header}#pragma once
+
+// {source} packed - created by tools/qwfont_pack.py
+//
+// {size} bytes, {raw} bytes unpacked
+
+// Define the font attributes
+#define FONT_{NAME}_RLE_WIDTH        {width}
+#define FONT_{NAME}_RLE_HEIGHT       {height}
+#define FONT_{NAME}_RLE_START        {start}
+#define FONT_{NAME}_RLE_NCHAR        {n_chars}
+#define FONT_{NAME}_RLE_GLYPH_BYTES  {glyph_bytes}
+#define FONT_{NAME}_RLE_NAME         "{font_name}"
+
+// Glyph records and packed glyph data - see QwPackedFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font{name}_rle_data[] = {{
+#else
+	static const uint8_t font{name}_rle_data[] PROGMEM = {{
+#endif
+	// glyph records - offset, width, x offset, advance
+{records}
+	// packed glyph data
+{data}
+}};
+"""
+
+OBJECT_HEADER = """// qw_fnt_{name}_rle.h
+//
+// Packed version of the {font_name} font - created by tools/qwfont_pack.py from {source}
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwFont{Class}RLE final : public packedFontSingleton<QwFont{Class}RLE> {{
+
+public:
+    const uint8_t* data(void)
+    {{
+        // include font data (static const), and attribute defines.
+        // Doing this here makes the data variable a static (aka only one instance ever)
+        // variable in this method.
+#include "_fnt_{name}_rle.h"
+
+        return font{name}_rle_data;
+    }}
+
+    uint8_t* glyphBuffer(void)
+    {{
+        static uint8_t buffer[FONT_{NAME}_RLE_GLYPH_BYTES];
+        return buffer;
+    }}
+
+    QwFont{Class}RLE()
+        : packedFontSingleton<QwFont{Class}RLE>(FONT_{NAME}_RLE_WIDTH,
+            FONT_{NAME}_RLE_HEIGHT,
+            FONT_{NAME}_RLE_START,
+            FONT_{NAME}_RLE_NCHAR,
+            FONT_{NAME}_RLE_NAME)
+    {{
+    }}
+}};
+
+#define QW_FONT_{NAME}_RLE QwFont{Class}RLE::instance()
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create a packed version of a fixed width font of the SparkFun Qwiic OLED library")
+    parser.add_argument("source", help="font data header, for example src/res/_fnt_31x48.h")
+    parser.add_argument("name", help="resource name")
+    parser.add_argument("-o", dest="out_dir", default=".", help="output directory")
+    args = parser.parse_args()
+
+    source = args.source
+    name = args.name.lower()
+
+    font = read_font(source)
+    records, packed, glyph_bytes = pack(font)
+
+    n_rows = font["height"] // 8 if font["height"] > 8 else 1
+    raw = font["n_chars"] * font["width"] * n_rows
+    start = font["start"]
+
+    record_lines = []
+    for index, (offset, width, x_offset, advance) in enumerate(records):
+        code = start + index
+        record_lines.append("\t0x{:02X}, 0x{:02X}, {}, {}, {}, // {}".format(
+            offset & 0xFF, offset >> 8, width, x_offset, advance,
+            repr(chr(code)) if 32 < code < 127 and chr(code) != "\\" else "0x{:02X}".format(code)))
+
+    data_lines = []
+    for i in range(0, len(packed), 16):
+        data_lines.append("\t" + ", ".join("0x{:02X}".format(v) for v in packed[i:i + 16]) + ",")
+
+    fields = {
+        "header": font["header"],
+        "source": os.path.basename(source),
+        "name": name,
+        "NAME": name.upper(),
+        "Class": class_name(args.name, source),
+        "font_name": font["name"],
+        "width": font["width"],
+        "height": font["height"],
+        "start": start,
+        "n_chars": font["n_chars"],
+        "glyph_bytes": glyph_bytes,
+        "size": len(records) * GLYPH_RECORD_BYTES + len(packed),
+        "raw": raw,
+        "records": "\n".join(record_lines),
+        "data": "\n".join(data_lines).rstrip(","),
+    }
+
+    with open(os.path.join(args.out_dir, "_fnt_{}_rle.h".format(name)), "w") as f:
+        f.write(DATA_HEADER.format(**fields))
+
+    with open(os.path.join(args.out_dir, "qw_fnt_{}_rle.h".format(name)), "w") as f:
+        f.write(OBJECT_HEADER.format(**fields))
+
+    print("{}: {} glyphs, {} bytes -> {} bytes".format(name, font["n_chars"], raw, fields["size"]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+#
+# qwfont_subset.py
+#
+# This is a tool for the SparkFun Qwiic OLED Arduino Library.
+#
+# Creates a subset font resource for the library from the data header of a fixed
+# width font (for example src/res/_fnt_31x48.h) - with only the glyphs of the
+# characters an application uses, and a table that maps characters to glyphs. The
+# text drawn, and the string sizes, are the same as the source font.
+#
+# The characters are given on the command line, and/or found in the string and
+# character literals of the application source files - so the font can be made
+# as part of the build:
+#
+#       --text <text>       the characters of the text (UTF-8)
+#       --chars <ranges>    character codes and ranges, for example 48-58,0x20
+#       --scan <files>      the characters of the literals in C/C++ (.ino) files
+#
+# Two files are written to the output directory, following the layout of the
+# resources in src/res:
+#
+#       _fnt_<name>.h   - the subset font tables, in PROGMEM, and the font defines
+#       qw_fnt_<name>.h - the font object. Use QW_FONT_<NAME> in a sketch
+#
+# Usage:
+#       python3 qwfont_subset.py <font data header> <name> [--text ..] [--chars ..] [--scan ..] [-o directory]
+#
+# The name is used for the file names and defines (lower/upper case) and for the
+# class name - for example 31x48_clock creates QwFont31x48Clock.
+#
+# The subset font format is described in src/res/qwiic_resdef.h (QwSubsetFont).
+#
+# Repository:
+#     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+#
+# SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+#
+# SPDX-License-Identifier: MIT
+#
+#    The MIT License (MIT)
+#
+#    Copyright (c) 2022 SparkFun Electronics
+#    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+#    associated documentation files (the "Software"), to deal in the Software without restriction,
+#    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+#    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+#    do so, subject to the following conditions:
+#    The above copyright notice and this permission notice shall be included in all copies or substantial
+#    portions of the Software.
+#    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+#    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+#    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+#    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+#    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+import argparse
+import os
+import re
+import sys
+
+from qwfont_pack import read_font, glyph_rows
+
+NO_GLYPH = 0xFF  # kSubsetFontNoGlyph
+
+# C string and character literals - the prefix (u8, L ...) is ignored
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+ESCAPE = re.compile(rb'\\(x[0-9a-fA-F]{1,2}|[0-7]{1,3}|.)', re.S)
+SIMPLE_ESCAPES = {b"n": 10, b"t": 9, b"r": 13, b"0": 0, b"a": 7, b"b": 8, b"f": 12, b"v": 11}
+
+
+def class_name(name):
+    """Class name part from a resource name - 31x48_clock -> 31x48Clock"""
+    return "".join(part[:1].upper() + part[1:] for part in name.split("_"))
+
+
+def data_lines(data):
+    """Format bytes for a data array - 16 per line"""
+    return "\n".join("\t" + ", ".join("0x{:02X}".format(v) for v in data[i:i + 16]) + ","
+                     for i in range(0, len(data), 16))
+
+
+def code_comment(code):
+    """Comment for a character code - the character if printable ASCII"""
+    if 32 < code < 127 and chr(code) not in "\\'":
+        return repr(chr(code))
+    return "U+{:04X}".format(code)
+
+
+def parse_chars(spec):
+    """The character codes of --chars - codes and ranges"""
+    codes = set()
+    for part in spec.split(","):
+        part = part.strip()
+        if not part:
+            continue
+        if "-" in part:
+            low, high = part.split("-", 1)
+            codes.update(range(int(low, 0), int(high, 0) + 1))
+        else:
+            codes.add(int(part, 0))
+    return codes
+
+
+def unescape(literal):
+    """The bytes of a C literal body"""
+    def replace(match):
+        esc = match.group(1)
+        if esc[:1] == b"x":
+            return bytes([int(esc[1:], 16)])
+        if esc[:1].isdigit() and esc not in SIMPLE_ESCAPES:
+            return bytes([int(esc, 8) & 0xFF])
+        return bytes([SIMPLE_ESCAPES.get(esc, esc[0])])
+
+    return ESCAPE.sub(replace, literal)
+
+
+def text_codes(data):
+    """Character codes of UTF-8 text, as the library decodes them - bytes that aren't
+    valid UTF-8 are codes of their own (see qwNextCode())"""
+    codes = set()
+    for c in data.decode("utf-8", "surrogateescape"):
+        code = ord(c)
+        codes.add(code - 0xDC00 if 0xDC80 <= code <= 0xDCFF else code)
+    return codes
+
+
+def scan_sources(paths):
+    """Character codes used in the string and character literals of source files"""
+    codes = set()
+    for path in paths:
+        with open(path, "rb") as f:
+            source = f.read().decode("utf-8", "surrogateescape")
+
+        # skip comments, so apostrophes in them don't start literals
+        source = re.sub(r"/\*.*?\*/|//[^\n]*", " ", source, flags=re.S)
+
+        for match in LITERAL.finditer(source):
+            body = match.group(1) if match.group(1) is not None else match.group(2)
+            codes |= text_codes(unescape(body.encode("utf-8", "surrogateescape")))
+    return codes
+
+
+DATA_HEADER = """{header}#pragma once
+
+// Subset of {source} - created by tools/qwfont_subset.py
+//
+// {n_glyphs} of {n_source} characters: {chars}
+// {size} bytes, {raw} bytes for the full font
+
+// Define the font attributes
+#define FONT_{NAME}_WIDTH        {width}
+#define FONT_{NAME}_HEIGHT       {height}
+#define FONT_{NAME}_START        {start}
+#define FONT_{NAME}_NCHAR        {n_chars}
+#define FONT_{NAME}_NGLYPH       {n_glyphs}
+#define FONT_{NAME}_NAME         "{font_name}"
+
+// Remap table and font map - see QwSubsetFont in qwiic_resdef.h
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font{name}_data[] = {{
+#else
+	static const uint8_t font{name}_data[] PROGMEM = {{
+#endif
+	// remap table - the glyph cell of each character
+{remap}
+	// font map
+{data}
+}};
+"""
+
+OBJECT_HEADER = """// qw_fnt_{name}.h
+//
+// Subset of the {font_name} font - created by tools/qwfont_subset.py from {source}
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwFont{Class} final : public subsetFontSingleton<QwFont{Class}> {{
+
+public:
+    const uint8_t* data(void)
+    {{
+        // include font data (static const), and attribute defines.
+        // Doing this here makes the data variable a static (aka only one instance ever)
+        // variable in this method.
+#include "_fnt_{name}.h"
+
+        return font{name}_data;
+    }}
+
+    QwFont{Class}()
+        : subsetFontSingleton<QwFont{Class}>(FONT_{NAME}_WIDTH,
+            FONT_{NAME}_HEIGHT,
+            FONT_{NAME}_START,
+            FONT_{NAME}_NCHAR,
+            FONT_{NAME}_NGLYPH,
+            FONT_{NAME}_NAME)
+    {{
+    }}
+}};
+
+#define QW_FONT_{NAME} QwFont{Class}::instance()
+"""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create a subset of a fixed width font of the SparkFun Qwiic OLED library")
+    parser.add_argument("source", help="font data header, for example src/res/_fnt_31x48.h")
+    parser.add_argument("name", help="resource name")
+    parser.add_argument("--text", help="characters to include")
+    parser.add_argument("--chars", default="", help="character codes and ranges to include, for example 48-58")
+    parser.add_argument("--scan", nargs="+", default=[], help="source files - include the characters of their literals")
+    parser.add_argument("-o", dest="out_dir", default=".", help="output directory")
+    args = parser.parse_args()
+
+    font = read_font(args.source)
+    start, n_source = font["start"], font["n_chars"]
+
+    codes = parse_chars(args.chars) | scan_sources(args.scan)
+    if args.text:
+        codes |= text_codes(args.text.encode("utf-8", "surrogateescape"))
+
+    # only the characters of the font - the others are blank with the full font as well
+    codes = sorted(c for c in codes if start <= c < start + n_source)
+    if not codes:
+        sys.exit("None of the characters are in the font")
+    if len(codes) >= NO_GLYPH:
+        sys.exit("Subset fonts are limited to {} characters".format(NO_GLYPH - 1))
+
+    width, n_rows = font["width"], font["height"] // 8 if font["height"] > 8 else 1
+    first, last = codes[0], codes[-1]
+
+    remap = [NO_GLYPH] * (last - first + 1)
+    rows = [[] for _ in range(n_rows)]
+    for cell, code in enumerate(codes):
+        remap[code - first] = cell
+        for row, values in enumerate(glyph_rows(font, code - start)):
+            rows[row].extend(values)
+
+    data = [v for row in rows for v in row]
+    size = len(remap) + len(data)
+
+    name = args.name.lower()
+    fields = {
+        "header": font["header"],
+        "source": os.path.basename(args.source),
+        "name": name,
+        "NAME": name.upper(),
+        "Class": class_name(args.name),
+        "font_name": font["name"],
+        "width": width,
+        "height": font["height"],
+        "start": first,
+        "n_chars": len(remap),
+        "n_glyphs": len(codes),
+        "n_source": n_source,
+        "chars": " ".join(code_comment(c) for c in codes),
+        "size": size,
+        "raw": len(font["data"]),
+        "remap": data_lines(remap),
+        "data": data_lines(data).rstrip(","),
+    }
+
+    with open(os.path.join(args.out_dir, "_fnt_{}.h".format(name)), "w") as f:
+        f.write(DATA_HEADER.format(**fields))
+
+    with open(os.path.join(args.out_dir, "qw_fnt_{}.h".format(name)), "w") as f:
+        f.write(OBJECT_HEADER.format(**fields))
+
+    print("{}: {} of {} characters, {} bytes -> {} bytes".format(name, len(codes), n_source, len(font["data"]), size))
+
+
+if __name__ == "__main__":
+    main()
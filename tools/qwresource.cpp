@@ -0,0 +1,1786 @@
+// qwresource.cpp
+//
+// This is a tool for the SparkFun Qwiic OLED Arduino Library.
+//
+// Creates font and bitmap resources for the library:
+//
+//       - fonts from BDF (Glyph Bitmap Distribution Format) files - fixed width,
+//         proportional or packed (run length encoded) fonts, with any subset of the
+//         characters of the font. Proportional fonts keep the metrics of each glyph.
+//
+//       - bitmaps from PNG or PBM (P1 or P4) files - in the graphics buffer (page)
+//         layout, or run length encoded. Gray and color images are converted to one
+//         bit with a threshold, an ordered (Bayer) dither or error diffusion.
+//
+// Two files are written to the output directory, following the layout of the
+// resources in src/res:
+//
+//       _fnt_<name>.h / _bmp_<name>.h     - the data, in PROGMEM, and the attribute defines
+//       qw_fnt_<name>.h / qw_bmp_<name>.h - the resource object. Use QW_FONT_<NAME> or
+//                                           QW_BMP_<NAME> in a sketch
+//
+// The size of the data (flash) - and of the glyph buffer (RAM) of a packed font - is
+// written to the data header and printed.
+//
+// The tool is a single C++11 file that only uses the standard library - PNG image
+// data is decompressed by the inflate decoder below. Build it with any host compiler:
+//
+//       g++ -std=c++11 -O2 -o qwresource tools/qwresource.cpp
+//
+// Usage:
+//       qwresource font <file.bdf> <name> [options]
+//       qwresource bitmap <file.png | file.pbm> <name> [options]
+//
+//   Font options:
+//       --format fixed | proportional | packed   font type - default proportional
+//       --chars <ranges>    characters to include - codes or ranges, for example
+//                           32-126,0xB0,0x2190-0x2193
+//       --text <text>       include the characters of the text (UTF-8) - adds to --chars.
+//                           Without --chars or --text, characters 32 - 126 are included
+//       --title <name>      font name - default the BDF family name
+//
+//   A proportional font with characters above 255, or with a sparse set of characters,
+//   is written as a sparse font - whichever is smaller. Fixed and packed fonts need
+//   characters 0 - 255; gaps in the range are blank.
+//
+//   Bitmap options:
+//       --rle               run length encode the bitmap
+//       --dither none | ordered | diffusion   gray to one bit conversion - default none
+//       --threshold <n>     ink level (0 - 255) that sets a pixel, without dithering - default 128
+//       --invert            light pixels are set - by default dark pixels are set, as in PBM files
+//
+//   Common options:
+//       -o <directory>      output directory - default the current directory
+//
+// The name is used for the file names and defines (lower/upper case) and for the
+// class name - for example clock_digits creates QwFontClockDigits.
+//
+// The resource formats are described in src/res/qwiic_resdef.h. The run length
+// encoding is the same as tools/qwbitmap_rle.py.
+//
+// Repository:
+//     https://github.com/sparkfun/SparkFun_Qwiic_OLED_Arduino_Library
+//
+// SparkFun code, firmware, and software is released under the MIT License(http://opensource.org/licenses/MIT).
+//
+// SPDX-License-Identifier: MIT
+//
+//    The MIT License (MIT)
+//
+//    Copyright (c) 2022 SparkFun Electronics
+//    Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+//    associated documentation files (the "Software"), to deal in the Software without restriction,
+//    including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//    and/or sell copies of the Software, and to permit persons to whom the Software is furnished to
+//    do so, subject to the following conditions:
+//    The above copyright notice and this permission notice shall be included in all copies or substantial
+//    portions of the Software.
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+//    NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+//    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+//    WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+typedef std::vector<int> ByteList;
+typedef std::vector<ByteList> ByteRows;
+typedef std::map<std::string, std::string> Fields;
+
+// Packet limits - see qwiic_resdef.h
+#define kMaxLiteral 128
+#define kMaxRepeat 129
+
+// Record sizes - see qwiic_resdef.h
+#define kPropGlyphBytes 5
+#define kSparseCodeBytes 2
+
+// The 8x8 Bayer matrix - the same as setFillDither()
+static const int bayer8x8[8][8] = {
+    {0, 32, 8, 40, 2, 34, 10, 42},  {48, 16, 56, 24, 50, 18, 58, 26}, {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22}, {3, 35, 11, 43, 1, 33, 9, 41},   {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},  {63, 31, 55, 23, 61, 29, 53, 21}};
+
+////////////////////////////////////////////////////////////////////////////////////
+// Helpers
+
+static void fail(const std::string &message)
+{
+    fprintf(stderr, "%s\n", message.c_str());
+    exit(1);
+}
+
+static std::string str(long value)
+{
+    return std::to_string(value);
+}
+
+static std::string hexByte(int value)
+{
+    char buffer[8];
+    snprintf(buffer, sizeof(buffer), "0x%02X", value & 0xFF);
+    return buffer;
+}
+
+static std::string toLower(std::string text)
+{
+    for (size_t i = 0; i < text.size(); i++)
+        text[i] = (char)tolower((unsigned char)text[i]);
+    return text;
+}
+
+static std::string toUpper(std::string text)
+{
+    for (size_t i = 0; i < text.size(); i++)
+        text[i] = (char)toupper((unsigned char)text[i]);
+    return text;
+}
+
+static bool isSpace(int c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static std::string strip(const std::string &text, const char *chars = " \t\n\r\v\f")
+{
+    size_t start = text.find_first_not_of(chars);
+    if (start == std::string::npos)
+        return "";
+    return text.substr(start, text.find_last_not_of(chars) - start + 1);
+}
+
+static std::vector<std::string> splitWords(const std::string &line)
+{
+    std::vector<std::string> words;
+    std::istringstream stream(line);
+    std::string word;
+    while (stream >> word)
+        words.push_back(word);
+    return words;
+}
+
+static bool endsWith(const std::string &text, const std::string &suffix)
+{
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static std::string baseName(const std::string &path)
+{
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static std::string joinPath(const std::string &dir, const std::string &file)
+{
+    if (dir.empty() || dir[dir.size() - 1] == '/')
+        return dir + file;
+    return dir + "/" + file;
+}
+
+static std::vector<uint8_t> readFile(const std::string &path)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+        fail("Can't open " + path);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// An integer - decimal, or with a 0x, 0o or 0b prefix. Returns false if the text isn't a number
+static bool parseInt(const std::string &input, long &value, bool bPrefix = true)
+{
+    std::string text = strip(input);
+    size_t pos = 0;
+    bool bNegative = false;
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-'))
+        bNegative = text[pos++] == '-';
+
+    int base = 10;
+    if (bPrefix && text.size() - pos > 1 && text[pos] == '0' && isalpha((unsigned char)text[pos + 1]))
+    {
+        char prefix = (char)tolower((unsigned char)text[pos + 1]);
+        base = prefix == 'x' ? 16 : prefix == 'o' ? 8 : prefix == 'b' ? 2 : 0;
+        if (!base)
+            return false;
+        pos += 2;
+    }
+    if (pos == text.size())
+        return false;
+
+    // no leading zeros for decimal numbers, other than zero
+    if (base == 10 && bPrefix && text[pos] == '0' && text.find_first_not_of('0', pos) != std::string::npos)
+        return false;
+
+    value = 0;
+    for (; pos < text.size(); pos++)
+    {
+        int c = tolower((unsigned char)text[pos]);
+        int digit = isdigit(c) ? c - '0' : (c >= 'a' && c <= 'z') ? c - 'a' + 10 : 99;
+        if (digit >= base)
+            return false;
+        value = value * base + digit;
+    }
+    if (bNegative)
+        value = -value;
+    return true;
+}
+
+static long toInt(const std::string &text, bool bPrefix = false)
+{
+    long value;
+    if (!parseInt(text, value, bPrefix))
+        fail("Invalid number: " + text);
+    return value;
+}
+
+// Decode UTF-8 text - bytes that aren't valid UTF-8 map to U+DC80 - U+DCFF
+static std::vector<long> utf8Codes(const std::string &text)
+{
+    std::vector<long> codes;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        uint8_t c = text[i];
+        int n = c < 0x80 ? 0 : (c >= 0xC2 && c <= 0xDF) ? 1 : (c >= 0xE0 && c <= 0xEF) ? 2 : (c >= 0xF0 && c <= 0xF4) ? 3 : -1;
+        long code = n == 0 ? c : n == 1 ? c & 0x1F : n == 2 ? c & 0x0F : c & 0x07;
+
+        // the range of the second byte - excludes overlong forms and surrogates
+        uint8_t low = c == 0xE0 ? 0xA0 : c == 0xF0 ? 0x90 : 0x80;
+        uint8_t high = c == 0xED ? 0x9F : c == 0xF4 ? 0x8F : 0xBF;
+
+        int k = 0;
+        for (; k < n && i + 1 + k < text.size(); k++)
+        {
+            uint8_t next = text[i + 1 + k];
+            if (next < (k ? 0x80 : low) || next > (k ? 0xBF : high))
+                break;
+            code = (code << 6) | (next & 0x3F);
+        }
+
+        if (n < 0 || k < n)
+        {
+            codes.push_back(0xDC00 + c);
+            i++;
+        }
+        else
+        {
+            codes.push_back(code);
+            i += n + 1;
+        }
+    }
+    return codes;
+}
+
+// Latin-1 text (BDF files) to UTF-8
+static std::string latin1ToUtf8(const std::string &text)
+{
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        uint8_t c = text[i];
+        if (c < 0x80)
+            out += (char)c;
+        else
+        {
+            out += (char)(0xC0 | (c >> 6));
+            out += (char)(0x80 | (c & 0x3F));
+        }
+    }
+    return out;
+}
+
+// Class name part from a resource name - clock_digits -> ClockDigits
+static std::string className(const std::string &name)
+{
+    std::string out;
+    bool bStart = true;
+    for (size_t i = 0; i < name.size(); i++)
+    {
+        if (name[i] == '_')
+            bStart = true;
+        else
+        {
+            out += bStart ? (char)toupper((unsigned char)name[i]) : name[i];
+            bStart = false;
+        }
+    }
+    return out;
+}
+
+// Format bytes for a data array - 16 per line
+static std::string dataLines(const ByteList &data)
+{
+    std::string out;
+    for (size_t i = 0; i < data.size(); i += 16)
+    {
+        if (i)
+            out += "\n";
+        out += "\t";
+        for (size_t j = i; j < data.size() && j < i + 16; j++)
+            out += (j > i ? ", " : "") + hexByte(data[j]);
+        out += ",";
+    }
+    return out;
+}
+
+// Comment for a character code - the character if printable ASCII
+static std::string codeComment(long code)
+{
+    if (code > 32 && code < 127 && code != '\\' && code != '\'')
+        return std::string("'") + (char)code + "'";
+
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "U+%04lX", code);
+    return buffer;
+}
+
+// The character codes selected by --chars and --text
+static std::vector<long> parseChars(const std::string &spec, const std::string &text)
+{
+    std::set<long> codes;
+    std::stringstream stream(spec);
+    std::string part;
+    while (std::getline(stream, part, ','))
+    {
+        part = strip(part);
+        if (part.empty())
+            continue;
+
+        size_t dash = part.find('-');
+        if (dash != std::string::npos)
+        {
+            long low = toInt(part.substr(0, dash), true);
+            long high = toInt(part.substr(dash + 1), true);
+            for (long code = low; code <= high && code <= 0xFFFF; code++)
+                codes.insert(code);
+        }
+        else
+            codes.insert(toInt(part, true));
+    }
+
+    std::vector<long> textCodes = utf8Codes(text);
+    codes.insert(textCodes.begin(), textCodes.end());
+
+    std::vector<long> result;
+    for (std::set<long>::iterator it = codes.begin(); it != codes.end(); it++)
+    {
+        if (*it <= 0xFFFF)
+            result.push_back(*it);
+    }
+    return result;
+}
+
+// Replace the {field} names of a template
+static std::string format(const std::string &text, const Fields &fields)
+{
+    std::string out;
+    size_t pos = 0;
+    while (pos < text.size())
+    {
+        size_t open = text.find('{', pos);
+        size_t close = open == std::string::npos ? open : text.find('}', open);
+        if (close == std::string::npos)
+            break;
+
+        Fields::const_iterator field = fields.find(text.substr(open + 1, close - open - 1));
+        if (field == fields.end())
+        {
+            out += text.substr(pos, open + 1 - pos);
+            pos = open + 1;
+            continue;
+        }
+        out += text.substr(pos, open - pos) + field->second;
+        pos = close + 1;
+    }
+    return out + text.substr(pos);
+}
+
+static void writeFiles(const std::string &outDir, const std::string &kind, const std::string &name,
+                       const char *dataHeader, const char *objectHeader, const Fields &fields)
+{
+    const char *headers[] = {dataHeader, objectHeader};
+    const char *prefixes[] = {"_", "qw_"};
+
+    for (int i = 0; i < 2; i++)
+    {
+        std::string path = joinPath(outDir, prefixes[i] + kind + "_" + name + ".h");
+        std::ofstream file(path.c_str(), std::ios::binary);
+        if (!file)
+            fail("Can't write " + path);
+        file << format(headers[i], fields);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Run length encoding
+
+static ByteList encode(const ByteList &data)
+{
+    ByteList out;
+    ByteList literals;
+
+    size_t i = 0;
+    while (i < data.size())
+    {
+        size_t run = 1;
+        while (i + run < data.size() && run < kMaxRepeat && data[i + run] == data[i])
+            run++;
+
+        // a run of 2 only pays off if it doesn't split a literal packet
+        if (run >= 3 || (run == 2 && literals.empty()))
+        {
+            if (!literals.empty())
+            {
+                out.push_back((int)literals.size() - 1);
+                out.insert(out.end(), literals.begin(), literals.end());
+                literals.clear();
+            }
+            out.push_back(0x80 | (int)(run - 2));
+            out.push_back(data[i]);
+            i += run;
+        }
+        else
+        {
+            literals.push_back(data[i]);
+            if (literals.size() == kMaxLiteral)
+            {
+                out.push_back((int)literals.size() - 1);
+                out.insert(out.end(), literals.begin(), literals.end());
+                literals.clear();
+            }
+            i++;
+        }
+    }
+    if (!literals.empty())
+    {
+        out.push_back((int)literals.size() - 1);
+        out.insert(out.end(), literals.begin(), literals.end());
+    }
+
+    return out;
+}
+
+// Decode - used to verify the encoded data
+static ByteList decode(const ByteList &data, size_t size)
+{
+    ByteList out;
+    size_t pos = 0;
+    while (out.size() < size && pos < data.size())
+    {
+        int control = data[pos++];
+        if (control & 0x80)
+        {
+            out.insert(out.end(), (control & 0x7F) + 2, pos < data.size() ? data[pos] : 0);
+            pos++;
+        }
+        else
+        {
+            for (int i = 0; i <= control && pos < data.size(); i++)
+                out.push_back(data[pos++]);
+        }
+    }
+    return out;
+}
+
+static ByteList encodeChecked(const ByteList &data)
+{
+    ByteList encoded = encode(data);
+    if (decode(encoded, data.size()) != data)
+        fail("Internal error - encoded data doesn't match");
+    return encoded;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Inflate
+//
+// Decompresses zlib (RFC 1950) data - the image data of PNG files. This is a plain
+// bit-at-a-time decoder of the deflate format (RFC 1951); speed isn't a concern for
+// the size of the images used with the library.
+
+class Inflate
+{
+public:
+    Inflate(const std::vector<uint8_t> &input) : m_input(input), m_pos(0), m_bitBuffer(0), m_bitCount(0)
+    {
+    }
+
+    bool decompress(std::vector<uint8_t> &out)
+    {
+        if (m_input.size() < 2 || (m_input[0] & 0x0F) != 8 || ((m_input[0] << 8) | m_input[1]) % 31 ||
+            (m_input[1] & 0x20))
+            return false;
+        m_pos = 2;
+
+        int last;
+        do
+        {
+            last = bits(1);
+            int type = bits(2);
+            bool bOK = type == 0 ? stored(out) : type == 1 ? fixed(out) : type == 2 ? dynamic(out) : false;
+            if (!bOK || m_pos > m_input.size())
+                return false;
+        } while (!last);
+
+        return true;
+    }
+
+private:
+    struct Huffman
+    {
+        uint16_t count[16];   // number of codes of each length
+        uint16_t symbol[320]; // symbols ordered by code
+    };
+
+    int bits(int need)
+    {
+        long value = m_bitBuffer;
+        while (m_bitCount < need)
+        {
+            // past the end reads zeros - caught by the position check
+            int next = m_pos < m_input.size() ? m_input[m_pos] : 0;
+            m_pos++;
+            value |= (long)next << m_bitCount;
+            m_bitCount += 8;
+        }
+        m_bitBuffer = (int)(value >> need);
+        m_bitCount -= need;
+        return (int)(value & ((1L << need) - 1));
+    }
+
+    static bool build(Huffman &h, const uint8_t *lengths, int n)
+    {
+        uint16_t offsets[16];
+        memset(h.count, 0, sizeof(h.count));
+        for (int s = 0; s < n; s++)
+            h.count[lengths[s]]++;
+
+        offsets[1] = 0;
+        for (int len = 1; len < 15; len++)
+            offsets[len + 1] = offsets[len] + h.count[len];
+
+        for (int s = 0; s < n; s++)
+        {
+            if (lengths[s])
+                h.symbol[offsets[lengths[s]]++] = s;
+        }
+        return true;
+    }
+
+    int decodeSymbol(const Huffman &h)
+    {
+        int code = 0, first = 0, index = 0;
+        for (int len = 1; len < 16; len++)
+        {
+            code |= bits(1);
+            int count = h.count[len];
+            if (code - count < first)
+                return h.symbol[index + (code - first)];
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    bool stored(std::vector<uint8_t> &out)
+    {
+        m_bitBuffer = 0;
+        m_bitCount = 0;
+        if (m_pos + 4 > m_input.size())
+            return false;
+
+        unsigned length = m_input[m_pos] | (m_input[m_pos + 1] << 8);
+        unsigned check = m_input[m_pos + 2] | (m_input[m_pos + 3] << 8);
+        m_pos += 4;
+        if (length != (~check & 0xFFFF) || m_pos + length > m_input.size())
+            return false;
+
+        out.insert(out.end(), m_input.begin() + m_pos, m_input.begin() + m_pos + length);
+        m_pos += length;
+        return true;
+    }
+
+    bool codes(std::vector<uint8_t> &out, const Huffman &lengthCodes, const Huffman &distanceCodes)
+    {
+        static const uint16_t lengthBase[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                                31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        static const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                                2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        static const uint16_t distanceBase[30] = {1,   2,   3,   4,   5,   7,    9,    13,   17,   25,
+                                                  33,  49,  65,  97,  129, 193,  257,  385,  513,  769,
+                                                  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        static const uint8_t distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                                  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        while (m_pos <= m_input.size())
+        {
+            int symbol = decodeSymbol(lengthCodes);
+            if (symbol < 0 || symbol > 285)
+                return false;
+            if (symbol == 256)
+                return true;
+            if (symbol < 256)
+            {
+                out.push_back((uint8_t)symbol);
+                continue;
+            }
+
+            symbol -= 257;
+            size_t length = lengthBase[symbol] + bits(lengthExtra[symbol]);
+
+            symbol = decodeSymbol(distanceCodes);
+            if (symbol < 0 || symbol > 29)
+                return false;
+            size_t distance = distanceBase[symbol] + bits(distanceExtra[symbol]);
+            if (distance > out.size())
+                return false;
+
+            for (size_t i = 0; i < length; i++)
+                out.push_back(out[out.size() - distance]);
+        }
+        return false;
+    }
+
+    bool fixed(std::vector<uint8_t> &out)
+    {
+        uint8_t lengths[288];
+        int s = 0;
+        for (; s < 144; s++)
+            lengths[s] = 8;
+        for (; s < 256; s++)
+            lengths[s] = 9;
+        for (; s < 280; s++)
+            lengths[s] = 7;
+        for (; s < 288; s++)
+            lengths[s] = 8;
+
+        Huffman lengthCodes, distanceCodes;
+        build(lengthCodes, lengths, 288);
+
+        for (s = 0; s < 30; s++)
+            lengths[s] = 5;
+        build(distanceCodes, lengths, 30);
+
+        return codes(out, lengthCodes, distanceCodes);
+    }
+
+    bool dynamic(std::vector<uint8_t> &out)
+    {
+        static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+        int nLength = bits(5) + 257;
+        int nDistance = bits(5) + 1;
+        int nCode = bits(4) + 4;
+        if (nLength > 286 || nDistance > 30)
+            return false;
+
+        uint8_t lengths[320];
+        memset(lengths, 0, sizeof(lengths));
+        for (int i = 0; i < nCode; i++)
+            lengths[order[i]] = bits(3);
+
+        Huffman lengthCodes, distanceCodes;
+        build(lengthCodes, lengths, 19);
+
+        // the code lengths of both codes, run length encoded
+        int index = 0;
+        while (index < nLength + nDistance)
+        {
+            int symbol = decodeSymbol(lengthCodes);
+            if (symbol < 0)
+                return false;
+            if (symbol < 16)
+            {
+                lengths[index++] = symbol;
+                continue;
+            }
+
+            int value = 0, repeat;
+            if (symbol == 16)
+            {
+                if (!index)
+                    return false;
+                value = lengths[index - 1];
+                repeat = 3 + bits(2);
+            }
+            else if (symbol == 17)
+                repeat = 3 + bits(3);
+            else
+                repeat = 11 + bits(7);
+
+            if (index + repeat > nLength + nDistance)
+                return false;
+            while (repeat--)
+                lengths[index++] = value;
+        }
+        if (!lengths[256])
+            return false;
+
+        build(lengthCodes, lengths, nLength);
+        build(distanceCodes, lengths + nLength, nDistance);
+
+        return codes(out, lengthCodes, distanceCodes);
+    }
+
+    const std::vector<uint8_t> &m_input;
+    size_t m_pos;
+    int m_bitBuffer;
+    int m_bitCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+// PNG
+
+struct Image
+{
+    int width;
+    int height;
+    std::vector<std::vector<int>> luminance; // 0 - 255
+    std::vector<std::vector<int>> alpha;     // 0 - 255
+};
+
+static int paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    return pb <= pc ? b : c;
+}
+
+static uint32_t bigEndian(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Read a PNG file - the luminance and alpha of each pixel
+static Image readPNG(const std::string &path)
+{
+    std::vector<uint8_t> data = readFile(path);
+
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (data.size() < 8 || memcmp(data.data(), signature, 8))
+        fail("Not a PNG file: " + path);
+
+    size_t pos = 8;
+    std::vector<uint8_t> idat, palette, trns;
+    int width = 0, height = 0, depth = 0, color = -1, interlace = 0;
+    while (pos + 8 <= data.size())
+    {
+        size_t length = bigEndian(&data[pos]);
+        std::string chunk(data.begin() + pos + 4, data.begin() + pos + 8);
+        if (pos + 8 + length > data.size())
+            fail("Truncated PNG file: " + path);
+        std::vector<uint8_t> body(data.begin() + pos + 8, data.begin() + pos + 8 + length);
+        pos += length + 12;
+
+        if (chunk == "IHDR" && length >= 13)
+        {
+            width = bigEndian(&body[0]);
+            height = bigEndian(&body[4]);
+            depth = body[8];
+            color = body[9];
+            interlace = body[12];
+        }
+        else if (chunk == "PLTE")
+            palette = body;
+        else if (chunk == "tRNS")
+            trns = body;
+        else if (chunk == "IDAT")
+            idat.insert(idat.end(), body.begin(), body.end());
+        else if (chunk == "IEND")
+            break;
+    }
+
+    if (interlace)
+        fail("Interlaced PNG files aren't supported");
+    if (color != 0 && color != 2 && color != 3 && color != 4 && color != 6)
+        fail("Unsupported PNG color type: " + str(color));
+    if (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16)
+        fail("Unsupported PNG bit depth: " + str(depth));
+
+    static const int colorChannels[7] = {1, 0, 3, 1, 2, 0, 4};
+    int channels = colorChannels[color];
+    size_t stride = ((size_t)width * channels * depth + 7) / 8;
+    size_t bpp = channels * depth / 8 ? channels * depth / 8 : 1; // filter byte distance
+
+    std::vector<uint8_t> raw;
+    if (!Inflate(idat).decompress(raw) || raw.size() < (stride + 1) * height)
+        fail("Invalid PNG image data: " + path);
+
+    Image image;
+    image.width = width;
+    image.height = height;
+
+    std::vector<uint8_t> prev(stride, 0);
+    std::vector<int> samples(width * channels);
+    for (int y = 0; y < height; y++)
+    {
+        // undo the row filter
+        size_t start = y * (stride + 1);
+        int filter = raw[start];
+        std::vector<uint8_t> line(raw.begin() + start + 1, raw.begin() + start + 1 + stride);
+        for (size_t i = 0; i < stride; i++)
+        {
+            int a = i >= bpp ? line[i - bpp] : 0;
+            int c = i >= bpp ? prev[i - bpp] : 0;
+            if (filter == 1)
+                line[i] += a;
+            else if (filter == 2)
+                line[i] += prev[i];
+            else if (filter == 3)
+                line[i] += (a + prev[i]) / 2;
+            else if (filter == 4)
+                line[i] += paeth(a, prev[i], c);
+        }
+        prev = line;
+
+        // samples - scaled to 8 bits
+        int mask = (1 << depth) - 1;
+        for (int i = 0; i < width * channels; i++)
+        {
+            if (depth == 16)
+                samples[i] = line[i * 2];
+            else if (depth == 8)
+                samples[i] = line[i];
+            else
+            {
+                int perByte = 8 / depth;
+                int value = (line[i / perByte] >> (8 - depth * (i % perByte + 1))) & mask;
+                samples[i] = color == 3 ? value : value * 255 / mask; // palette indexes aren't scaled
+            }
+        }
+
+        std::vector<int> luminance(width), alpha(width, 255);
+        for (int x = 0; x < width; x++)
+        {
+            if (color == 0)
+                luminance[x] = samples[x];
+            else if (color == 4)
+            {
+                luminance[x] = samples[2 * x];
+                alpha[x] = samples[2 * x + 1];
+            }
+            else
+            {
+                const int *rgb = &samples[x * channels];
+                int r, g, b;
+                if (color == 3)
+                {
+                    if ((size_t)rgb[0] * 3 + 3 > palette.size())
+                        fail("PNG palette index out of range: " + path);
+                    r = palette[rgb[0] * 3];
+                    g = palette[rgb[0] * 3 + 1];
+                    b = palette[rgb[0] * 3 + 2];
+                    if ((size_t)rgb[0] < trns.size())
+                        alpha[x] = trns[rgb[0]];
+                }
+                else
+                {
+                    r = rgb[0];
+                    g = rgb[1];
+                    b = rgb[2];
+                    if (color == 6)
+                        alpha[x] = rgb[3];
+                }
+                luminance[x] = (299 * r + 587 * g + 114 * b) / 1000;
+            }
+        }
+        image.luminance.push_back(luminance);
+        image.alpha.push_back(alpha);
+    }
+
+    return image;
+}
+
+// Convert the image to one bit pixels (1 = set)
+static std::vector<std::vector<int>> toPixels(const Image &image, const std::string &dither, long threshold,
+                                              bool bInvert)
+{
+    int width = image.width, height = image.height;
+
+    // ink level - transparent pixels are never set
+    std::vector<std::vector<double>> ink(height, std::vector<double>(width));
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int lum = image.luminance[y][x];
+            ink[y][x] = (bInvert ? lum : 255 - lum) * image.alpha[y][x] / 255.0;
+        }
+    }
+
+    // Floyd-Steinberg error weights
+    static const int diffusion[4][3] = {{1, 0, 7}, {-1, 1, 3}, {0, 1, 5}, {1, 1, 1}};
+
+    std::vector<std::vector<int>> pixels(height, std::vector<int>(width, 0));
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (dither == "ordered")
+                pixels[y][x] = bayer8x8[y % 8][x % 8] < (int)(ink[y][x] * 64 / 255 + 0.5);
+            else if (dither == "diffusion")
+            {
+                int value = ink[y][x] >= 128 ? 255 : 0;
+                pixels[y][x] = value > 0;
+                double error = ink[y][x] - value;
+                for (int i = 0; i < 4; i++)
+                {
+                    int dx = diffusion[i][0], dy = diffusion[i][1];
+                    if (x + dx >= 0 && x + dx < width && y + dy < height)
+                        ink[y + dy][x + dx] += error * diffusion[i][2] / 16;
+                }
+            }
+            else
+                pixels[y][x] = ink[y][x] >= threshold;
+        }
+    }
+
+    return pixels;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// PBM
+
+// Read a P1 or P4 pbm file - rows of pixels (1 = on)
+static std::vector<std::vector<int>> readPBM(const std::string &path, int &width, int &height)
+{
+    std::vector<uint8_t> data = readFile(path);
+
+    // header tokens - magic, width, height - skipping comments
+    std::vector<std::string> tokens;
+    size_t pos = 0;
+    while (tokens.size() < 3 && pos < data.size())
+    {
+        while (pos < data.size() && isSpace(data[pos]))
+            pos++;
+        if (pos < data.size() && data[pos] == '#')
+        {
+            while (pos < data.size() && data[pos] != '\n')
+                pos++;
+            continue;
+        }
+        size_t start = pos;
+        while (pos < data.size() && !isSpace(data[pos]))
+            pos++;
+        if (pos > start)
+            tokens.push_back(std::string(data.begin() + start, data.begin() + pos));
+    }
+    if (tokens.size() < 3)
+        fail("Invalid pbm file: " + path);
+
+    std::string magic = tokens[0];
+    width = (int)toInt(tokens[1]);
+    height = (int)toInt(tokens[2]);
+
+    std::vector<std::vector<int>> rows(height, std::vector<int>(width, 0));
+    if (magic == "P4")
+    {
+        pos++; // single whitespace before the raster
+        size_t stride = (width + 7) / 8;
+        if (pos + stride * height > data.size())
+            fail("Not enough pbm data: " + path);
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+                rows[y][x] = (data[pos + y * stride + x / 8] >> (7 - x % 8)) & 1;
+        }
+    }
+    else if (magic == "P1")
+    {
+        std::vector<int> bits;
+        for (; pos < data.size(); pos++)
+        {
+            if (data[pos] == '0' || data[pos] == '1')
+                bits.push_back(data[pos] - '0');
+        }
+        if (bits.size() < (size_t)width * height)
+            fail("Not enough pbm data: " + path);
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+                rows[y][x] = bits[y * width + x];
+        }
+    }
+    else
+        fail("Unsupported pbm format: " + magic);
+
+    return rows;
+}
+
+// Convert rows of pixels to the graphics buffer (page) layout
+static ByteList pixelsToPages(int width, int height, const std::vector<std::vector<int>> &rows)
+{
+    ByteList pages;
+    for (int page = 0; page < (height + 7) / 8; page++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int value = 0;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                int y = page * 8 + bit;
+                if (y < height && rows[y][x])
+                    value |= 1 << bit;
+            }
+            pages.push_back(value);
+        }
+    }
+    return pages;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Bitmaps
+
+static const char *bitmapDataHeader = R"(// _bmp_{name}.h
+//
+// {description} - created by tools/qwresource.cpp from {source}
+//
+// {size} bytes of flash{raw_note}
+
+#pragma once
+
+#define BMP_{NAME}_WIDTH  {width}
+#define BMP_{NAME}_HEIGHT {height}
+
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t bmp_{name}_data[] = {
+#else
+	static const uint8_t bmp_{name}_data[] PROGMEM = {
+#endif
+{data}
+};
+)";
+
+static const char *bitmapObjectHeader = R"(// qw_bmp_{name}.h
+//
+// {description} - created by tools/qwresource.cpp from {source}
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwBMP{Class} final : public bmpSingleton<QwBMP{Class}> {
+
+public:
+    const uint8_t* data(void)
+    {
+
+#include "_bmp_{name}.h"
+
+        return bmp_{name}_data;
+    }
+
+    QwBMP{Class}()
+        : bmpSingleton<QwBMP{Class}>(BMP_{NAME}_WIDTH, BMP_{NAME}_HEIGHT{format})
+    {
+    }
+
+    // compile time attributes
+    typedef QwBitmapTraits<BMP_{NAME}_WIDTH, BMP_{NAME}_HEIGHT> traits;
+};
+
+#define QW_BMP_{NAME} QwBMP{Class}::instance()
+)";
+
+struct Options
+{
+    std::string command;
+    std::string source;
+    std::string name;
+    std::string outDir;
+
+    // fonts
+    std::string format;
+    std::string chars;
+    std::string text;
+    std::string title;
+
+    // bitmaps
+    bool bRLE;
+    std::string dither;
+    long threshold;
+    bool bInvert;
+};
+
+static void makeBitmap(const Options &options)
+{
+    int width, height;
+    std::vector<std::vector<int>> pixels;
+
+    if (endsWith(toLower(options.source), ".png"))
+    {
+        Image image = readPNG(options.source);
+        width = image.width;
+        height = image.height;
+        pixels = toPixels(image, options.dither, options.threshold, options.bInvert);
+    }
+    else
+    {
+        pixels = readPBM(options.source, width, height);
+        for (int y = 0; options.bInvert && y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+                pixels[y][x] = 1 - pixels[y][x];
+        }
+    }
+
+    if (width > 255 || height > 255)
+        fail("Bitmaps are limited to 255 x 255 pixels");
+
+    ByteList data = pixelsToPages(width, height, pixels);
+    size_t raw = data.size();
+    if (options.bRLE)
+        data = encodeChecked(data);
+
+    std::string name = toLower(options.name);
+    Fields fields;
+    fields["name"] = name;
+    fields["NAME"] = toUpper(name);
+    fields["Class"] = className(options.name);
+    fields["source"] = baseName(options.source);
+    fields["description"] = options.bRLE ? "Run length encoded bitmap" : "Bitmap";
+    fields["width"] = str(width);
+    fields["height"] = str(height);
+    fields["size"] = str(data.size());
+    fields["raw_note"] = options.bRLE ? ", " + str(raw) + " bytes uncompressed" : "";
+    fields["format"] = options.bRLE ? ", grBitmapRLE" : "";
+    fields["data"] = dataLines(data);
+
+    writeFiles(options.outDir, "bmp", name, bitmapDataHeader, bitmapObjectHeader, fields);
+
+    printf("%s: %d x %d bitmap, %d bytes of flash%s\n", name.c_str(), width, height, (int)data.size(),
+           fields["raw_note"].c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Fonts
+
+struct BdfGlyph
+{
+    long code;
+    long advance;
+    std::vector<long> bbx; // width, height, x offset, y offset
+    std::vector<std::string> rows;
+};
+
+struct BdfFont
+{
+    std::map<std::string, long> values; // FONT_ASCENT, FONT_DESCENT, PIXEL_SIZE
+    std::map<std::string, std::string> names;     // FONT, FAMILY_NAME
+    std::vector<long> boundingBox;
+    std::map<long, BdfGlyph> glyphs;
+};
+
+// A rendered glyph - trimmed of empty columns
+struct Glyph
+{
+    long xOffset;
+    ByteRows rows;
+    long advance;
+};
+
+static int hexDigit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c = (char)tolower((unsigned char)c);
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+// Read a BDF font - the font properties and the glyphs by character code
+static BdfFont readBDF(const std::string &path)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+        fail("Can't open " + path);
+
+    BdfFont font;
+    BdfGlyph glyph;
+    bool bGlyph = false, bBitmap = false;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::vector<std::string> words = splitWords(line);
+        if (words.empty())
+            continue;
+        const std::string &key = words[0];
+
+        if (bBitmap)
+        {
+            if (key == "ENDCHAR")
+            {
+                if (glyph.code >= 0)
+                    font.glyphs[glyph.code] = glyph;
+                bGlyph = bBitmap = false;
+            }
+            else
+            {
+                for (size_t i = 0; i < key.size(); i++)
+                {
+                    if (hexDigit(key[i]) < 0)
+                        fail("Invalid glyph bitmap row: " + key);
+                }
+                glyph.rows.push_back(key);
+            }
+        }
+        else if (key == "STARTCHAR")
+        {
+            glyph = BdfGlyph();
+            glyph.code = -1;
+            glyph.advance = 0;
+            glyph.bbx.assign(4, 0);
+            bGlyph = true;
+        }
+        else if (bGlyph)
+        {
+            if (key == "ENCODING" && words.size() > 1)
+                glyph.code = toInt(words[1]);
+            else if (key == "DWIDTH" && words.size() > 1)
+                glyph.advance = toInt(words[1]);
+            else if (key == "BBX" && words.size() > 4)
+            {
+                for (int i = 0; i < 4; i++)
+                    glyph.bbx[i] = toInt(words[i + 1]);
+            }
+            else if (key == "BITMAP")
+                bBitmap = true;
+        }
+        else if ((key == "FONT_ASCENT" || key == "FONT_DESCENT" || key == "PIXEL_SIZE") && words.size() > 1)
+            font.values[key] = toInt(words[1]);
+        else if ((key == "FONT" || key == "FAMILY_NAME") && words.size() > 1)
+            font.names[key] = latin1ToUtf8(strip(strip(line.substr(line.find(key) + key.size())), "\""));
+        else if (key == "FONTBOUNDINGBOX" && words.size() > 4)
+        {
+            font.boundingBox.clear();
+            for (int i = 0; i < 4; i++)
+                font.boundingBox.push_back(toInt(words[i + 1]));
+        }
+    }
+
+    if (!font.values.count("FONT_ASCENT"))
+    {
+        // no ascent/descent properties - use the font bounding box
+        std::vector<long> box = font.boundingBox.empty() ? std::vector<long>(4, 0) : font.boundingBox;
+        font.values["FONT_ASCENT"] = box[1] + box[3];
+        font.values["FONT_DESCENT"] = -box[3];
+    }
+
+    return font;
+}
+
+// The columns of a glyph, trimmed of empty columns - the x offset and the page rows
+static Glyph renderGlyph(const BdfGlyph &bdf, long ascent, int height)
+{
+    long w = bdf.bbx[0], h = bdf.bbx[1];
+    int nRows = height / 8;
+    long top = ascent - bdf.bbx[3] - h; // cell row of the top of the bitmap
+
+    ByteRows columns;
+    long x0 = -1, x1 = -1;
+    for (long x = 0; x < w; x++)
+    {
+        ByteList column(nRows, 0);
+        bool bUsed = false;
+        for (long r = 0; r < h && r < (long)bdf.rows.size(); r++)
+        {
+            const std::string &row = bdf.rows[r];
+            long y = top + r;
+            if (y >= 0 && y < height && x < (long)row.size() * 4 && ((hexDigit(row[x / 4]) >> (3 - x % 4)) & 1))
+            {
+                column[y / 8] |= 1 << (y % 8);
+                bUsed = true;
+            }
+        }
+        columns.push_back(column);
+        if (bUsed)
+        {
+            if (x0 < 0)
+                x0 = x;
+            x1 = x;
+        }
+    }
+
+    Glyph glyph;
+    glyph.advance = bdf.advance;
+    glyph.rows.assign(nRows, ByteList());
+    if (x0 < 0)
+    {
+        glyph.xOffset = 0;
+        return glyph;
+    }
+
+    for (int row = 0; row < nRows; row++)
+    {
+        for (long x = x0; x <= x1; x++)
+            glyph.rows[row].push_back(columns[x][row]);
+    }
+    glyph.xOffset = bdf.bbx[2] + x0;
+    return glyph;
+}
+
+static const char *fontDataHeader = R"(// _fnt_{name}.h
+//
+// {font_name} - {description}, created by tools/qwresource.cpp from {source}
+//
+// {size} bytes of flash{ram_note}
+
+#pragma once
+
+// Define the font attributes
+{defines}
+
+#if defined(ARDUINO_ARCH_MBED)
+	// ARDUINO_ARCH_MBED (APOLLO3 v2) does not support or require pgmspace.h / PROGMEM
+	static const uint8_t font{name}_data[] = {
+#else
+	static const uint8_t font{name}_data[] PROGMEM = {
+#endif
+{data}
+};
+)";
+
+static const char *fontObjectHeader = R"(// qw_fnt_{name}.h
+//
+// {font_name} - {description}, created by tools/qwresource.cpp from {source}
+
+#pragma once
+
+#include "qwiic_resdef.h"
+
+class QwFont{Class} final : public {singleton}<QwFont{Class}> {
+
+public:
+    const uint8_t* data(void)
+    {
+        // include font data (static const), and attribute defines.
+        // Doing this here makes the data variable a static (aka only one instance ever)
+        // variable in this method.
+#include "_fnt_{name}.h"
+
+        return font{name}_data;
+    }
+{glyph_buffer}
+    QwFont{Class}()
+        : {singleton}<QwFont{Class}>({arguments})
+    {
+    }
+{traits}};
+
+#define QW_FONT_{NAME} QwFont{Class}::instance()
+)";
+
+static const char *fontTraits = R"(
+    // compile time attributes - for text<Font>()
+    typedef QwFontTraits<FONT_{NAME}_WIDTH, FONT_{NAME}_HEIGHT, FONT_{NAME}_START, FONT_{NAME}_NCHAR,
+        FONT_{NAME}_MAP_WIDTH> traits;
+)";
+
+static const char *glyphBuffer = R"(
+    uint8_t* glyphBuffer(void)
+    {
+        static uint8_t buffer[FONT_{NAME}_GLYPH_BYTES];
+        return buffer;
+    }
+)";
+
+typedef std::vector<std::pair<std::string, std::string>> Defines;
+
+static void makeFont(const Options &options)
+{
+    BdfFont bdf = readBDF(options.source);
+
+    std::vector<long> codes;
+    std::vector<long> selected =
+        parseChars(options.chars.empty() && options.text.empty() ? "32-126" : options.chars, options.text);
+    for (size_t i = 0; i < selected.size(); i++)
+    {
+        if (bdf.glyphs.count(selected[i]))
+            codes.push_back(selected[i]);
+    }
+    if (codes.empty())
+        fail("None of the selected characters are in the font");
+
+    long ascent = bdf.values["FONT_ASCENT"];
+    long cellHeight = ascent + bdf.values["FONT_DESCENT"];
+    if (cellHeight > 248)
+        fail("Fonts are limited to 248 pixels high");
+
+    // The library draws fonts 8 pixels high, or a multiple of 8
+    int height = cellHeight > 8 ? (int)(cellHeight + 7) / 8 * 8 : 8;
+    int nRows = height / 8;
+
+    std::map<long, Glyph> glyphs;
+    for (size_t i = 0; i < codes.size(); i++)
+        glyphs[codes[i]] = renderGlyph(bdf.glyphs[codes[i]], ascent, height);
+
+    std::string name = toLower(options.name);
+    std::string NAME = toUpper(name);
+    std::string fontName = options.title;
+    if (fontName.empty())
+    {
+        fontName = !bdf.names["FAMILY_NAME"].empty() ? bdf.names["FAMILY_NAME"]
+                   : bdf.names.count("FONT")         ? bdf.names["FONT"]
+                                                     : name;
+        if (bdf.values.count("PIXEL_SIZE"))
+            fontName += " " + str(bdf.values["PIXEL_SIZE"]);
+    }
+
+    long first = codes.front(), last = codes.back();
+    bool bContiguous = last <= 255;
+    long nRange = bContiguous ? last - first + 1 : 0;
+
+    std::vector<std::string> lines;
+    long width, size, ram = 0;
+    std::string description, singleton;
+    Defines defines;
+    std::vector<std::string> arguments;
+
+    if (options.format == "fixed")
+    {
+        if (!bContiguous)
+            fail("Fixed width fonts are limited to characters 0 - 255");
+
+        // 8 pixel high fonts get a one pixel margin from the library - see QwFont::glyph()
+        int margin = nRows == 1 ? 1 : 0;
+        width = 0;
+        for (std::map<long, Glyph>::iterator it = glyphs.begin(); it != glyphs.end(); it++)
+            width = std::max(width, it->second.advance);
+        width -= margin;
+        if (width < 1 || width * nRange > 0xFFFF)
+            fail("The font map is over 64k bytes wide");
+
+        long mapWidth = width * nRange;
+        ByteList data;
+        for (int row = 0; row < nRows; row++)
+        {
+            for (long code = first; code <= last; code++)
+            {
+                ByteList cell(width, 0);
+                if (glyphs.count(code))
+                {
+                    const Glyph &glyph = glyphs[code];
+                    for (size_t i = 0; i < glyph.rows[row].size(); i++)
+                    {
+                        if (glyph.xOffset + (long)i >= 0 && glyph.xOffset + (long)i < width)
+                            cell[glyph.xOffset + i] = glyph.rows[row][i];
+                    }
+                }
+                data.insert(data.end(), cell.begin(), cell.end());
+            }
+        }
+
+        lines.push_back(dataLines(data));
+        description = "fixed width";
+        singleton = "fontSingleton";
+        defines = {{"WIDTH", str(width)},
+                   {"HEIGHT", str(height)},
+                   {"START", str(first)},
+                   {"NCHAR", str(nRange)},
+                   {"MAP_WIDTH", str(mapWidth)}};
+        arguments = {"WIDTH", "HEIGHT", "START", "NCHAR", "MAP_WIDTH", "NAME"};
+        size = data.size();
+    }
+    else
+    {
+        bool bPacked = options.format == "packed";
+        width = 0;
+        for (std::map<long, Glyph>::iterator it = glyphs.begin(); it != glyphs.end(); it++)
+            width = std::max(width, (long)it->second.rows[0].size());
+        long blankAdvance = width + (height < 16); // as a missing character - see QwFont::blankGlyph()
+
+        // Contiguous records, with blanks for the gaps, or sparse - whichever is smaller
+        bool bSparse = !bContiguous || (!bPacked && (long)codes.size() * (kPropGlyphBytes + kSparseCodeBytes) <
+                                                        nRange * kPropGlyphBytes);
+        if (bPacked && bSparse)
+            fail("Packed fonts are limited to characters 0 - 255");
+
+        std::vector<long> recordCodes;
+        if (bSparse)
+            recordCodes = codes;
+        else
+        {
+            for (long code = first; code <= last; code++)
+                recordCodes.push_back(code);
+        }
+
+        // glyph records - code, offset, width, x offset, advance
+        std::vector<std::vector<long>> records;
+        ByteList glyphData;
+        for (size_t i = 0; i < recordCodes.size(); i++)
+        {
+            long code = recordCodes[i];
+            if (!glyphs.count(code))
+            {
+                records.push_back({code, 0, 0, 0, blankAdvance});
+                continue;
+            }
+            const Glyph &glyph = glyphs[code];
+            ByteList data;
+            for (int row = 0; row < nRows; row++)
+                data.insert(data.end(), glyph.rows[row].begin(), glyph.rows[row].end());
+            if (bPacked && !data.empty())
+                data = encodeChecked(data);
+
+            records.push_back({code, (long)glyphData.size(), (long)glyph.rows[0].size(), glyph.xOffset, glyph.advance});
+            glyphData.insert(glyphData.end(), data.begin(), data.end());
+        }
+
+        if (glyphData.size() > 0xFFFF)
+            fail("Glyph data is over 64k bytes");
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            if (records[i][3] < -128 || records[i][3] > 127 || records[i][4] < 0 || records[i][4] > 255)
+                fail("Glyph offsets or advances are out of range");
+        }
+
+        if (bSparse)
+        {
+            ByteList codesData;
+            for (size_t i = 0; i < recordCodes.size(); i++)
+            {
+                codesData.push_back(recordCodes[i] & 0xFF);
+                codesData.push_back(recordCodes[i] >> 8);
+            }
+            lines.push_back("\t// character codes");
+            lines.push_back(dataLines(codesData));
+        }
+
+        lines.push_back("\t// glyph records - offset, width, x offset, advance");
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            const std::vector<long> &record = records[i];
+            long xOffset = record[3] < 0 ? record[3] & 0xFF : record[3];
+            lines.push_back("\t" + hexByte(record[1] & 0xFF) + ", " + hexByte(record[1] >> 8) + ", " +
+                            str(record[2]) + ", " + str(xOffset) + ", " + str(record[4]) + ", // " +
+                            codeComment(record[0]));
+        }
+
+        lines.push_back(bPacked ? "\t// packed glyph data" : "\t// glyph data");
+        lines.push_back(dataLines(glyphData));
+
+        size = (long)recordCodes.size() * (kPropGlyphBytes + (bSparse ? kSparseCodeBytes : 0)) + glyphData.size();
+
+        if (bPacked)
+        {
+            ram = width * nRows;
+            description = "packed";
+            singleton = "packedFontSingleton";
+            defines = {{"WIDTH", str(width)},
+                       {"HEIGHT", str(height)},
+                       {"START", str(first)},
+                       {"NCHAR", str(nRange)},
+                       {"GLYPH_BYTES", str(ram)}};
+            arguments = {"WIDTH", "HEIGHT", "START", "NCHAR", "NAME"};
+        }
+        else if (bSparse)
+        {
+            description = "sparse";
+            singleton = "sparseFontSingleton";
+            defines = {{"WIDTH", str(width)}, {"HEIGHT", str(height)}, {"NGLYPH", str(codes.size())}, {"NKERN", "0"}};
+            arguments = {"WIDTH", "HEIGHT", "NGLYPH", "NKERN", "NAME"};
+        }
+        else
+        {
+            description = "proportional";
+            singleton = "propFontSingleton";
+            defines = {{"WIDTH", str(width)},
+                       {"HEIGHT", str(height)},
+                       {"START", str(first)},
+                       {"NCHAR", str(nRange)},
+                       {"NKERN", "0"}};
+            arguments = {"WIDTH", "HEIGHT", "START", "NCHAR", "NKERN", "NAME"};
+        }
+    }
+
+    defines.push_back(std::make_pair("NAME", "\"" + fontName + "\""));
+
+    std::string defineText, argumentText, dataText;
+    for (size_t i = 0; i < defines.size(); i++)
+    {
+        std::string key = defines[i].first;
+        key.resize(std::max(key.size(), (size_t)12), ' ');
+        defineText += (i ? "\n" : "") + std::string("#define FONT_") + NAME + "_" + key + " " + defines[i].second;
+    }
+    for (size_t i = 0; i < arguments.size(); i++)
+        argumentText += (i ? ",\n            " : "") + std::string("FONT_") + NAME + "_" + arguments[i];
+    for (size_t i = 0; i < lines.size(); i++)
+        dataText += (i ? "\n" : "") + lines[i];
+    dataText.erase(dataText.find_last_not_of(',') + 1);
+
+    Fields fields;
+    fields["name"] = name;
+    fields["NAME"] = NAME;
+    fields["Class"] = className(options.name);
+    fields["source"] = baseName(options.source);
+    fields["font_name"] = fontName;
+    fields["description"] = description + " font";
+    fields["size"] = str(size);
+    fields["ram_note"] = ram ? ", " + str(ram) + " bytes of RAM for the glyph buffer" : "";
+    fields["defines"] = defineText;
+    fields["data"] = dataText;
+    fields["singleton"] = singleton;
+    fields["glyph_buffer"] = ram ? format(glyphBuffer, fields) : "";
+    fields["arguments"] = argumentText;
+    fields["traits"] = options.format == "fixed" ? format(fontTraits, fields) : "";
+
+    writeFiles(options.outDir, "fnt", name, fontDataHeader, fontObjectHeader, fields);
+
+    printf("%s: %s font, %d characters, %ld x %d, %ld bytes of flash%s\n", name.c_str(), description.c_str(),
+           (int)codes.size(), width, height, size, fields["ram_note"].c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Command line
+
+static const char *usage = "usage: qwresource font <file.bdf> <name> [--format fixed|proportional|packed]\n"
+                           "                       [--chars <ranges>] [--text <text>] [--title <name>] [-o <directory>]\n"
+                           "       qwresource bitmap <file.png|file.pbm> <name> [--rle]\n"
+                           "                       [--dither none|ordered|diffusion] [--threshold <n>] [--invert]\n"
+                           "                       [-o <directory>]\n";
+
+static void usageError(const std::string &message)
+{
+    fprintf(stderr, "%sqwresource: error: %s\n", usage, message.c_str());
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    options.outDir = ".";
+    options.format = "proportional";
+    options.bRLE = false;
+    options.dither = "none";
+    options.threshold = 128;
+    options.bInvert = false;
+
+    if (argc < 2 || !strcmp(argv[1], "-h") || !strcmp(argv[1], "--help"))
+    {
+        fputs(usage, argc < 2 ? stderr : stdout);
+        return argc < 2 ? 1 : 0;
+    }
+
+    options.command = argv[1];
+    bool bFont = options.command == "font";
+    if (!bFont && options.command != "bitmap")
+        usageError("unknown command '" + options.command + "' - use font or bitmap");
+
+    std::vector<std::string> positional;
+    for (int i = 2; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg.size() < 2 || arg[0] != '-')
+        {
+            positional.push_back(arg);
+            continue;
+        }
+
+        // --option value, --option=value, -o value or -o<value>
+        std::string option = arg, value;
+        bool bValue = false;
+        size_t equals = arg.find('=');
+        if (arg.compare(0, 2, "--") == 0 && equals != std::string::npos)
+        {
+            option = arg.substr(0, equals);
+            value = arg.substr(equals + 1);
+            bValue = true;
+        }
+        else if (arg.compare(0, 2, "-o") == 0 && arg.size() > 2)
+        {
+            option = "-o";
+            value = arg.substr(2);
+            bValue = true;
+        }
+
+        if (option == "-h" || option == "--help")
+        {
+            fputs(usage, stdout);
+            return 0;
+        }
+
+        // bitmap flags
+        if (!bFont && (option == "--rle" || option == "--invert"))
+        {
+            if (bValue)
+                usageError("argument " + option + ": ignored explicit argument '" + value + "'");
+            if (option == "--rle")
+                options.bRLE = true;
+            else
+                options.bInvert = true;
+            continue;
+        }
+
+        static const char *fontOptions[] = {"--format", "--chars", "--text", "--title", "-o"};
+        static const char *bitmapOptions[] = {"--dither", "--threshold", "-o"};
+        const char **valueOptions = bFont ? fontOptions : bitmapOptions;
+        int nValueOptions = bFont ? 5 : 3;
+
+        bool bKnown = false;
+        for (int n = 0; n < nValueOptions; n++)
+            bKnown = bKnown || option == valueOptions[n];
+        if (!bKnown)
+            usageError("unrecognized arguments: " + arg);
+
+        if (!bValue)
+        {
+            if (i + 1 >= argc)
+                usageError("argument " + option + ": expected one argument");
+            value = argv[++i];
+        }
+
+        if (option == "-o")
+            options.outDir = value;
+        else if (option == "--format")
+        {
+            if (value != "fixed" && value != "proportional" && value != "packed")
+                usageError("argument --format: invalid choice: '" + value + "' (choose from fixed, proportional, packed)");
+            options.format = value;
+        }
+        else if (option == "--chars")
+            options.chars = value;
+        else if (option == "--text")
+            options.text = value;
+        else if (option == "--title")
+            options.title = value;
+        else if (option == "--dither")
+        {
+            if (value != "none" && value != "ordered" && value != "diffusion")
+                usageError("argument --dither: invalid choice: '" + value + "' (choose from none, ordered, diffusion)");
+            options.dither = value;
+        }
+        else if (option == "--threshold")
+        {
+            if (!parseInt(value, options.threshold, false))
+                usageError("argument --threshold: invalid int value: '" + value + "'");
+        }
+    }
+
+    if (positional.size() < 2)
+        usageError("the following arguments are required: source, name");
+    if (positional.size() > 2)
+        usageError("unrecognized arguments: " + positional[2]);
+    options.source = positional[0];
+    options.name = positional[1];
+
+    if (bFont)
+        makeFont(options);
+    else
+        makeBitmap(options);
+
+    return 0;
+}